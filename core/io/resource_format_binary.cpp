@@ -36,6 +36,7 @@
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
+#include "core/templates/local_vector.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -105,23 +106,48 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+// Packed arrays are stored as raw blocks of elements in the endianness the file was saved with,
+// so they can be read and written in bulk whenever it matches the one of the host.
+static _FORCE_INLINE_ bool _file_needs_byte_swap(const Ref<FileAccess> &p_f) {
+#ifdef BIG_ENDIAN_ENABLED
+	return !p_f->is_big_endian();
+#else
+	return p_f->is_big_endian();
+#endif
+}
+
+static void _read_packed_32(Ref<FileAccess> &f, void *p_dst, size_t p_count) {
+	f->get_buffer((uint8_t *)p_dst, p_count * sizeof(uint32_t));
+	if (_file_needs_byte_swap(f)) {
+		uint32_t *ptr = (uint32_t *)p_dst;
+		for (size_t i = 0; i < p_count; i++) {
+			ptr[i] = BSWAP32(ptr[i]);
+		}
+	}
+}
+
+static void _read_packed_64(Ref<FileAccess> &f, void *p_dst, size_t p_count) {
+	f->get_buffer((uint8_t *)p_dst, p_count * sizeof(uint64_t));
+	if (_file_needs_byte_swap(f)) {
+		uint64_t *ptr = (uint64_t *)p_dst;
+		for (size_t i = 0; i < p_count; i++) {
+			ptr[i] = BSWAP64(ptr[i]);
+		}
+	}
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *dst = (uint64_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP64(dst[i]);
-				}
-			}
-#endif
+			_read_packed_64(f, dst, count);
 		} else if constexpr (sizeof(real_t) == 4) {
-			// May be slower, but this is for compatibility. Eventually the data should be converted.
+			// Slower, as it needs a conversion, but this is for compatibility. Eventually the data should be converted.
+			LocalVector<double> buffer;
+			buffer.resize(count);
+			_read_packed_64(f, buffer.ptr(), count);
 			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_double();
+				dst[i] = buffer[i];
 			}
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
@@ -129,18 +155,13 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	} else {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *dst = (uint32_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP32(dst[i]);
-				}
-			}
-#endif
+			_read_packed_32(f, dst, count);
 		} else if constexpr (sizeof(real_t) == 8) {
+			LocalVector<float> buffer;
+			buffer.resize(count);
+			_read_packed_32(f, buffer.ptr(), count);
 			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_float();
+				dst[i] = buffer[i];
 			}
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
@@ -400,6 +421,18 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 					if (using_named_scene_ids) { // New format.
 						ERR_FAIL_INDEX_V((int)index, internal_resources.size(), ERR_PARSE_ERROR);
+						if (load_on_demand) {
+							// Materialize it now, then come back to the property being parsed.
+							uint64_t pos = f->get_position();
+							Ref<Resource> res;
+							Error err = _load_internal_resource(index, &res);
+							f->seek(pos);
+							if (err != OK) {
+								return err;
+							}
+							r_v = res;
+							break;
+						}
 						path = internal_resources[index].path;
 					} else {
 						path += res_path + "::" + itos(index);
@@ -446,7 +479,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					} else {
 						if (external_resources[erindex].cache.is_null()) {
 							//cache not here yet, wait for it?
-							if (use_sub_threads) {
+							if (load_on_demand) {
+								Error err = _load_external_resource(erindex);
+								if (err != OK) {
+									return err;
+								}
+							} else if (use_sub_threads) {
 								Error err;
 								external_resources.write[erindex].cache = ResourceLoader::load_threaded_get(external_resources[erindex].path, &err);
 
@@ -524,16 +562,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			_read_packed_32(f, w, len);
 
 			r_v = array;
 		} break;
@@ -543,16 +572,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			_read_packed_64(f, w, len);
 
 			r_v = array;
 		} break;
@@ -562,16 +582,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			_read_packed_32(f, w, len);
 
 			r_v = array;
 		} break;
@@ -581,16 +592,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			_read_packed_64(f, w, len);
 
 			r_v = array;
 		} break;
@@ -640,16 +642,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len * 4; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			_read_packed_32(f, w, len * 4);
 
 			r_v = array;
 		} break;
@@ -669,195 +662,239 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
-
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+Error ResourceLoaderBinary::_load_external_resource(int p_index) {
+	String path = external_resources[p_index].path;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (remaps.has(path)) {
+		path = remaps[path];
+	}
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
-		}
+	if (!path.contains("://") && path.is_relative_path()) {
+		// path is relative to file being loaded, so convert to a resource path
+		path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[p_index].path));
+	}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	external_resources.write[p_index].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
 
-		if (!use_sub_threads) {
-			external_resources.write[i].cache = ResourceLoader::load(path, external_resources[i].type);
+	if (!use_sub_threads) {
+		external_resources.write[p_index].cache = ResourceLoader::load(path, external_resources[p_index].type);
 
-			if (external_resources[i].cache.is_null()) {
-				if (!ResourceLoader::get_abort_on_missing_resources()) {
-					ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-				} else {
-					error = ERR_FILE_MISSING_DEPENDENCIES;
-					ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
-				}
+		if (external_resources[p_index].cache.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[p_index].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
 			}
+		}
 
-		} else {
-			Error err = ResourceLoader::load_threaded_request(path, external_resources[i].type, use_sub_threads, ResourceFormatLoader::CACHE_MODE_REUSE, local_path);
-			if (err != OK) {
-				if (!ResourceLoader::get_abort_on_missing_resources()) {
-					ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-				} else {
-					error = ERR_FILE_MISSING_DEPENDENCIES;
-					ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
-				}
+	} else {
+		Error err = ResourceLoader::load_threaded_request(path, external_resources[p_index].type, use_sub_threads, ResourceFormatLoader::CACHE_MODE_REUSE, local_path);
+		if (err != OK) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[p_index].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
 			}
 		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	return OK;
+}
+
+void ResourceLoaderBinary::_resolve_internal_resource_paths() {
+	// The last internal resource is the main one and keeps the path of the file.
+	for (int i = 0; i < internal_resources.size() - 1; i++) {
+		String path = internal_resources[i].path;
+		if (path.begins_with("local://")) {
+			String id = path.replace_first("local://", "");
+			internal_resources.write[i].id = id;
+			internal_resources.write[i].path = res_path + "::" + id;
+		}
+	}
+}
 
-		//maybe it is loaded already
-		String path;
-		String id;
+Error ResourceLoaderBinary::_load_internal_resource(int p_index, Ref<Resource> *r_resource) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	if (!main) {
+		path = internal_resources[p_index].path;
+		id = internal_resources[p_index].id;
 
-				internal_resources.write[i].path = path; // Update path.
+		if (internal_index_cache.has(path)) {
+			if (r_resource) {
+				*r_resource = internal_index_cache[path];
 			}
+			return OK;
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				internal_index_cache[path] = cached;
+				if (r_resource) {
+					*r_resource = cached;
 				}
-			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	ERR_FAIL_COND_V_MSG(internal_resources[p_index].loading, ERR_CYCLIC_LINK, local_path + ": Cyclic reference to internal resource: " + path + ".");
+	internal_resources.write[p_index].loading = true;
 
-		f->seek(offset);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		String t = get_unicode_string();
+	f->seek(offset);
 
-		Ref<Resource> res;
+	String t = get_unicode_string();
 
-		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-			//use the existing one
-			Ref<Resource> cached = ResourceCache::get_ref(path);
-			if (cached->get_class() == t) {
-				cached->reset_state();
-				res = cached;
-			}
-		}
+	Ref<Resource> res;
 
-		MissingResource *missing_resource = nullptr;
+	if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+		//use the existing one
+		Ref<Resource> cached = ResourceCache::get_ref(path);
+		if (cached->get_class() == t) {
+			cached->reset_state();
+			res = cached;
+		}
+	}
 
-		if (res.is_null()) {
-			//did not replace
+	MissingResource *missing_resource = nullptr;
 
-			Object *obj = ClassDB::instantiate(t);
-			if (!obj) {
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					//create a missing resource
-					missing_resource = memnew(MissingResource);
-					missing_resource->set_original_class(t);
-					missing_resource->set_recording_properties(true);
-					obj = missing_resource;
-				} else {
-					error = ERR_FILE_CORRUPT;
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-				}
-			}
+	if (res.is_null()) {
+		//did not replace
 
-			Resource *r = Object::cast_to<Resource>(obj);
-			if (!r) {
-				String obj_class = obj->get_class();
+		Object *obj = ClassDB::instantiate(t);
+		if (!obj) {
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				//create a missing resource
+				missing_resource = memnew(MissingResource);
+				missing_resource->set_original_class(t);
+				missing_resource->set_recording_properties(true);
+				obj = missing_resource;
+			} else {
 				error = ERR_FILE_CORRUPT;
-				memdelete(obj); //bye
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 			}
+		}
 
-			res = Ref<Resource>(r);
-			if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
-			}
-			r->set_scene_unique_id(id);
+		Resource *r = Object::cast_to<Resource>(obj);
+		if (!r) {
+			String obj_class = obj->get_class();
+			error = ERR_FILE_CORRUPT;
+			memdelete(obj); //bye
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		res = Ref<Resource>(r);
+		if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+			r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		int pc = f->get_32();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		//set properties
+	int pc = f->get_32();
 
-		Dictionary missing_resource_properties;
+	//set properties
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	Dictionary missing_resource_properties;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-			Variant value;
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+		Variant value;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-			if (set_valid) {
-				res->set(name, value);
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
 #ifdef TOOLS_ENABLED
-		res->set_edited(false);
+	res->set_edited(false);
 #endif
 
+	internal_resources.write[p_index].loading = false;
+	resource_cache.push_back(res);
+
+	if (r_resource) {
+		*r_resource = res;
+	}
+	return OK;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		error = _load_external_resource(i);
+		if (error != OK) {
+			return error;
+		}
+	}
+
+	_resolve_internal_resource_paths();
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		bool main = i == (internal_resources.size() - 1);
+
+		Ref<Resource> res;
+		error = _load_internal_resource(i, &res);
+		if (error != OK) {
+			return error;
+		}
+
 		if (progress) {
 			*progress = (i + 1) / float(internal_resources.size());
 		}
 
-		resource_cache.push_back(res);
-
 		if (main) {
 			f.unref();
 			resource = res;
@@ -870,6 +907,41 @@ Error ResourceLoaderBinary::load() {
 	return ERR_FILE_EOF;
 }
 
+// Loads only the internal resource with the given scene unique ID, plus the internal and external
+// resources it depends on, which are materialized as they are found while parsing it. The offset
+// table stored in the header allows seeking straight to each of them without decoding the rest.
+Error ResourceLoaderBinary::load_sub_resource(const String &p_id) {
+	if (error != OK) {
+		return error;
+	}
+
+	ERR_FAIL_COND_V_MSG(!using_named_scene_ids, ERR_UNAVAILABLE, "Cannot load sub-resource '" + p_id + "' from '" + local_path + "' on its own, as the file was saved in an older format. Re-save it to enable this.");
+
+	load_on_demand = true;
+	_resolve_internal_resource_paths();
+
+	for (int i = 0; i < internal_resources.size() - 1; i++) {
+		if (internal_resources[i].id != p_id) {
+			continue;
+		}
+
+		Ref<Resource> res;
+		error = _load_internal_resource(i, &res);
+		f.unref();
+		if (error != OK) {
+			return error;
+		}
+
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		return OK;
+	}
+
+	f.unref();
+	error = ERR_FILE_NOT_FOUND;
+	ERR_FAIL_V_MSG(error, "Sub-resource '" + p_id + "' not found in '" + local_path + "'.");
+}
+
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
 	translation_remapped = p_remapped;
 }
@@ -1122,21 +1194,36 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 		*r_error = ERR_FILE_CANT_OPEN;
 	}
 
+	// A path like "res://library.res::Animation_abcde" loads just that sub-resource.
+	String file_path = p_path;
+	String original_path = !p_original_path.is_empty() ? p_original_path : p_path;
+	String sub_resource_id;
+	int sub_resource_pos = file_path.find("::");
+	if (sub_resource_pos != -1) {
+		sub_resource_id = file_path.substr(sub_resource_pos + 2);
+		file_path = file_path.substr(0, sub_resource_pos);
+		original_path = original_path.get_slice("::", 0);
+	}
+
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ, &err);
 
-	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + p_path + "'.");
+	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), "Cannot open file '" + file_path + "'.");
 
 	ResourceLoaderBinary loader;
 	loader.cache_mode = p_cache_mode;
-	loader.use_sub_threads = p_use_sub_threads;
+	loader.use_sub_threads = p_use_sub_threads && sub_resource_id.is_empty();
 	loader.progress = r_progress;
-	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+	String path = original_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
 	loader.open(f);
 
-	err = loader.load();
+	if (!sub_resource_id.is_empty()) {
+		err = loader.load_sub_resource(sub_resource_id);
+	} else {
+		err = loader.load();
+	}
 
 	if (r_error) {
 		*r_error = err;
@@ -1176,6 +1263,11 @@ void ResourceFormatLoaderBinary::get_recognized_extensions(List<String> *p_exten
 	}
 }
 
+bool ResourceFormatLoaderBinary::recognize_path(const String &p_path, const String &p_for_type) const {
+	// Sub-resource paths are recognized by the extension of the file containing them.
+	return ResourceFormatLoader::recognize_path(p_path.get_slice("::", 0), p_for_type);
+}
+
 bool ResourceFormatLoaderBinary::handles_type(const String &p_type) const {
 	return true; //handles all
 }
@@ -1445,6 +1537,36 @@ ResourceUID::ID ResourceFormatLoaderBinary::get_resource_uid(const String &p_pat
 ///////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////
 
+static void _store_packed_32(Ref<FileAccess> f, const void *p_src, size_t p_count) {
+	if (!_file_needs_byte_swap(f)) {
+		f->store_buffer((const uint8_t *)p_src, p_count * sizeof(uint32_t));
+		return;
+	}
+	const uint32_t *src = (const uint32_t *)p_src;
+	for (size_t i = 0; i < p_count; i++) {
+		f->store_32(src[i]);
+	}
+}
+
+static void _store_packed_64(Ref<FileAccess> f, const void *p_src, size_t p_count) {
+	if (!_file_needs_byte_swap(f)) {
+		f->store_buffer((const uint8_t *)p_src, p_count * sizeof(uint64_t));
+		return;
+	}
+	const uint64_t *src = (const uint64_t *)p_src;
+	for (size_t i = 0; i < p_count; i++) {
+		f->store_64(src[i]);
+	}
+}
+
+static void _store_packed_reals(Ref<FileAccess> f, const real_t *p_src, size_t p_count) {
+	if constexpr (sizeof(real_t) == 8) {
+		_store_packed_64(f, p_src, p_count);
+	} else {
+		_store_packed_32(f, p_src, p_count);
+	}
+}
+
 void ResourceFormatSaverBinaryInstance::_pad_buffer(Ref<FileAccess> f, int p_bytes) {
 	int extra = 4 - (p_bytes % 4);
 	if (extra < 4) {
@@ -1771,10 +1893,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int32_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const int32_t *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_32(r[i]);
-			}
+			_store_packed_32(f, arr.ptr(), len);
 
 		} break;
 		case Variant::PACKED_INT64_ARRAY: {
@@ -1782,10 +1901,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int64_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const int64_t *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_64(r[i]);
-			}
+			_store_packed_64(f, arr.ptr(), len);
 
 		} break;
 		case Variant::PACKED_FLOAT32_ARRAY: {
@@ -1793,10 +1909,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<float> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const float *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_float(r[i]);
-			}
+			_store_packed_32(f, arr.ptr(), len);
 
 		} break;
 		case Variant::PACKED_FLOAT64_ARRAY: {
@@ -1804,10 +1917,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<double> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const double *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_double(r[i]);
-			}
+			_store_packed_64(f, arr.ptr(), len);
 
 		} break;
 		case Variant::PACKED_STRING_ARRAY: {
@@ -1826,12 +1936,8 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector3> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const Vector3 *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_real(r[i].x);
-				f->store_real(r[i].y);
-				f->store_real(r[i].z);
-			}
+			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+			_store_packed_reals(f, reinterpret_cast<const real_t *>(arr.ptr()), len * 3);
 
 		} break;
 		case Variant::PACKED_VECTOR2_ARRAY: {
@@ -1839,11 +1945,8 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector2> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const Vector2 *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_real(r[i].x);
-				f->store_real(r[i].y);
-			}
+			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+			_store_packed_reals(f, reinterpret_cast<const real_t *>(arr.ptr()), len * 2);
 
 		} break;
 		case Variant::PACKED_COLOR_ARRAY: {
@@ -1851,13 +1954,8 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Color> arr = p_property;
 			int len = arr.size();
 			f->store_32(len);
-			const Color *r = arr.ptr();
-			for (int i = 0; i < len; i++) {
-				f->store_float(r[i].r);
-				f->store_float(r[i].g);
-				f->store_float(r[i].b);
-				f->store_float(r[i].a);
-			}
+			static_assert(sizeof(Color) == 4 * sizeof(float));
+			_store_packed_32(f, arr.ptr(), len * 4);
 
 		} break;
 		default: {
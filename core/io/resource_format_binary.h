@@ -71,7 +71,9 @@ class ResourceLoaderBinary {
 
 	struct IntResource {
 		String path;
+		String id;
 		uint64_t offset;
+		bool loading = false;
 	};
 
 	Vector<IntResource> internal_resources;
@@ -82,6 +84,7 @@ class ResourceLoaderBinary {
 
 	HashMap<String, String> remaps;
 	Error error = OK;
+	bool load_on_demand = false;
 
 	ResourceFormatLoader::CacheMode cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
 
@@ -89,12 +92,17 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	Error _load_external_resource(int p_index);
+	void _resolve_internal_resource_paths();
+	Error _load_internal_resource(int p_index, Ref<Resource> *r_resource);
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
 	void set_local_path(const String &p_local_path);
 	Ref<Resource> get_resource();
 	Error load();
+	Error load_sub_resource(const String &p_id);
 	void set_translation_remapped(bool p_remapped);
 
 	void set_remaps(const HashMap<String, String> &p_remaps) { remaps = p_remaps; }
@@ -111,6 +119,7 @@ public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const;
+	virtual bool recognize_path(const String &p_path, const String &p_for_type = String()) const;
 	virtual bool handles_type(const String &p_type) const;
 	virtual String get_resource_type(const String &p_path) const;
 	virtual void get_classes_used(const String &p_path, HashSet<StringName> *r_classes);
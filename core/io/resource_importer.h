@@ -139,6 +139,12 @@ public:
 
 	virtual Error import(const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) = 0;
 	virtual bool can_import_threaded() const { return true; }
+	// Whether the imported files only depend on the source file contents, the options and the importer version,
+	// so they can be reused from the import cache when importing identical inputs. Importers whose output depends
+	// on the source path, on editor settings or on files other than the source (except res:// paths given as
+	// options), or that generate extra files, must return false. The texture, layered texture, image, WAV,
+	// Ogg Vorbis and MP3 importers are cacheable; scenes, fonts, translations and CSV files aren't.
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const { return false; }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
 
@@ -340,6 +340,33 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 	}
 }
 
+// Returns the function ClassDB::instantiate() would end up calling for p_class, so callers creating
+// many objects of the same class can skip the lookup. Only plain native classes are resolved,
+// anything else (disabled, editor-only outside the editor or GDExtension classes) returns nullptr.
+ClassDB::NativeCreationFunc ClassDB::get_native_creation_func(const StringName &p_class, StringName *r_created_class) {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || !ti->creation_func || (ti->native_extension && !ti->native_extension->create_instance)) {
+		if (compat_classes.has(p_class)) {
+			ti = classes.getptr(compat_classes[p_class]);
+		}
+	}
+	if (!ti || ti->disabled || !ti->creation_func || ti->native_extension) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+
+	if (r_created_class) {
+		*r_created_class = ti->name;
+	}
+	return ti->creation_func;
+}
+
 void ClassDB::set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance) {
 	ERR_FAIL_COND(!p_object);
 	ClassInfo *ti;
@@ -1203,6 +1230,28 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+// Resolves the same setter ClassDB::set_property() would call for p_property. Returns nullptr if the
+// property has no bound setter method, in which case it must be set through Object::set().
+MethodBind *ClassDB::get_property_setter_method(const StringName &p_class, const StringName &p_property, int *r_index) {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->setter ? psg->_setptr : nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
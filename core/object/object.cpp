@@ -1684,6 +1684,10 @@ bool Object::is_queued_for_deletion() const {
 	return _is_queued_for_deletion;
 }
 
+void Object::cancel_free() {
+	_predelete_ok = 0;
+}
+
 #ifdef TOOLS_ENABLED
 void Object::set_edited(bool p_edited) {
 	_edited = p_edited;
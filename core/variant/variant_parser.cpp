@@ -35,36 +35,73 @@
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
 
-char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+char32_t VariantParser::Stream::get_char() {
+	if (readahead_pointer < readahead_filled) {
+		return readahead_buffer[readahead_pointer++];
+	}
+
+	// Refill the buffer, or read a single character when readahead is disabled.
+	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
+	if (readahead_filled == 0) {
+		// Like FileAccess, EOF is only reported after trying to read past the end.
+		readahead_pointer = 0;
+		eof = true;
+		return 0;
+	}
+
+	readahead_pointer = 1;
+	return readahead_buffer[0];
+}
+
+bool VariantParser::Stream::is_eof() const {
+	if (readahead_enabled) {
+		return eof;
+	}
+	return _is_eof();
+}
+
+uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	ERR_FAIL_COND_V(p_num_chars == 0 || p_num_chars > READAHEAD_SIZE, 0);
+
+	uint8_t temp[READAHEAD_SIZE];
+	uint64_t num_read = f->get_buffer(temp, p_num_chars);
+	ERR_FAIL_COND_V(num_read == UINT64_MAX, 0);
+
+	for (uint32_t i = 0; i < num_read; i++) {
+		p_buffer[i] = temp[i];
+	}
+	return num_read;
 }
 
 bool VariantParser::StreamFile::is_utf8() const {
 	return true;
 }
 
-bool VariantParser::StreamFile::is_eof() const {
+bool VariantParser::StreamFile::_is_eof() const {
 	return f->eof_reached();
 }
 
-char32_t VariantParser::StreamString::get_char() {
-	if (pos > s.length()) {
-		return 0;
-	} else if (pos == s.length()) {
-		// You need to try to read again when you have reached the end for EOF to be reported,
-		// so this works the same as files (like StreamFile does)
-		pos++;
+uint32_t VariantParser::StreamString::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	int available = s.length() - pos;
+	if (available <= 0) {
+		// Step past the end so that _is_eof() reports it, like StreamFile does.
+		if (pos == s.length()) {
+			pos++;
+		}
 		return 0;
-	} else {
-		return s[pos++];
 	}
+
+	uint32_t num_read = MIN((uint32_t)available, p_num_chars);
+	memcpy(p_buffer, s.ptr() + pos, num_read * sizeof(char32_t));
+	pos += num_read;
+	return num_read;
 }
 
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
 
-bool VariantParser::StreamString::is_eof() const {
+bool VariantParser::StreamString::_is_eof() const {
 	return pos > s.length();
 }
 
@@ -979,17 +1016,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -997,17 +1024,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -1015,17 +1032,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -1033,17 +1040,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -1051,17 +1048,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
@@ -1097,17 +1084,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				cs.push_back(token.value);
 			}
 
-			Vector<String> arr;
-			{
-				int len = cs.size();
-				arr.resize(len);
-				String *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = cs[i];
-				}
-			}
-
-			value = arr;
+			value = cs;
 		} else if (id == "PackedVector2Array" || id == "PoolVector2Array" || id == "Vector2Array") {
 			Vector<real_t> args;
 			Error err = _parse_construct<real_t>(p_stream, args, line, r_err_str);
@@ -1120,8 +1097,9 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				int len = args.size() / 2;
 				arr.resize(len);
 				Vector2 *w = arr.ptrw();
+				const real_t *r = args.ptr();
 				for (int i = 0; i < len; i++) {
-					w[i] = Vector2(args[i * 2 + 0], args[i * 2 + 1]);
+					w[i] = Vector2(r[i * 2 + 0], r[i * 2 + 1]);
 				}
 			}
 
@@ -1138,8 +1116,9 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				int len = args.size() / 3;
 				arr.resize(len);
 				Vector3 *w = arr.ptrw();
+				const real_t *r = args.ptr();
 				for (int i = 0; i < len; i++) {
-					w[i] = Vector3(args[i * 3 + 0], args[i * 3 + 1], args[i * 3 + 2]);
+					w[i] = Vector3(r[i * 3 + 0], r[i * 3 + 1], r[i * 3 + 2]);
 				}
 			}
 
@@ -1156,8 +1135,9 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				int len = args.size() / 4;
 				arr.resize(len);
 				Color *w = arr.ptrw();
+				const float *r = args.ptr();
 				for (int i = 0; i < len; i++) {
-					w[i] = Color(args[i * 4 + 0], args[i * 4 + 1], args[i * 4 + 2], args[i * 4 + 3]);
+					w[i] = Color(r[i * 4 + 0], r[i * 4 + 1], r[i * 4 + 2], r[i * 4 + 3]);
 				}
 			}
 
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/extension/native_extension_manager.h"
+#include "core/io/config_file.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
 #include "core/io/resource_loader.h"
@@ -1903,10 +1904,23 @@ void EditorFileSystem::_reimport_file(const String &p_file, const HashMap<String
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = OK;
 
-	if (err != OK) {
-		ERR_PRINT("Error importing '" + p_file + "'.");
+	String cache_key;
+	if (GLOBAL_GET("editor/import/use_import_cache") && !importer->get_save_extension().is_empty() && importer->can_cache_import(params)) {
+		cache_key = EditorImportCache::get_key(p_file, importer, params);
+	}
+
+	if (cache_key.is_empty() || !import_cache.load(cache_key, base_path, importer, &import_variants, &meta)) {
+		import_variants.clear();
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		if (err != OK) {
+			ERR_PRINT("Error importing '" + p_file + "'.");
+		} else if (!cache_key.is_empty() && gen_files.is_empty()) {
+			import_cache.save(cache_key, base_path, importer, import_variants, meta);
+			import_cache_changed.set();
+		}
 	}
 
 	//as import is complete, save the .import file
@@ -2168,6 +2182,11 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	ResourceUID::get_singleton()->update_cache(); //after reimporting, update the cache
 
+	if (import_cache_changed.is_set()) {
+		import_cache_changed.clear();
+		import_cache.evict(uint64_t(int(GLOBAL_GET("editor/import/import_cache_max_size_mb"))) * 1024 * 1024);
+	}
+
 	_save_filesystem_cache();
 	importing = false;
 	if (!is_scanning()) {
@@ -2416,6 +2435,10 @@ EditorFileSystem::EditorFileSystem() {
 	ResourceLoader::import = _resource_import;
 	reimport_on_missing_imported_files = GLOBAL_DEF("editor/import/reimport_missing_imported_files", true);
 	GLOBAL_DEF("editor/import/use_multiple_threads", true);
+	GLOBAL_DEF("editor/import/use_import_cache", true);
+	GLOBAL_DEF("editor/import/import_cache_max_size_mb", 1024);
+	ProjectSettings::get_singleton()->set_custom_property_info("editor/import/import_cache_max_size_mb", PropertyInfo(Variant::INT, "editor/import/import_cache_max_size_mb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater,suffix:MiB"));
+	import_cache.set_cache_dir(EditorPaths::get_singleton()->get_cache_dir().path_join("import_cache"));
 	singleton = this;
 	filesystem = memnew(EditorFileSystemDirectory); //like, empty
 	filesystem->parent = nullptr;
@@ -36,9 +36,11 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/safe_refcount.h"
+#include "editor/editor_import_cache.h"
 #include "scene/main/node.h"
 
 class FileAccess;
+class ResourceImporter;
 
 struct EditorProgressBG;
 class EditorFileSystemDirectory : public Object {
@@ -202,6 +204,9 @@ class EditorFileSystem : public Node {
 
 	HashMap<String, FileCache> file_cache;
 
+	EditorImportCache import_cache;
+	SafeFlag import_cache_changed;
+
 	struct ScanProgress {
 		float low = 0;
 		float hi = 0;
@@ -239,6 +244,7 @@ class EditorFileSystem : public Node {
 	void _update_extensions();
 
 	void _reimport_file(const String &p_file, const HashMap<StringName, Variant> *p_custom_options = nullptr, const String &p_custom_importer = String());
+
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
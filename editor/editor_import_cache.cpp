@@ -0,0 +1,222 @@
+/*************************************************************************/
+/*  editor_import_cache.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "editor_import_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+
+String EditorImportCache::get_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const HashMap<StringName, Variant> &p_params) {
+	// The key only depends on the contents of the source file, not its path, so identical files share their imported data.
+	String key = p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version()) + ":" + p_importer->get_import_settings_string() + "\n";
+	key += FileAccess::get_sha256(p_file) + "\n";
+
+	// Options are stored in insertion order, sort them so the key doesn't depend on where they came from.
+	Vector<String> names;
+	for (const KeyValue<StringName, Variant> &E : p_params) {
+		names.push_back(E.key);
+	}
+	names.sort();
+
+	for (const String &name : names) {
+		const Variant &value = p_params[name];
+		String value_text;
+		VariantWriter::write_to_string(value, value_text);
+		key += name + "=" + value_text + "\n";
+
+		// Options can point to other files used by the import (like the normal map used for roughness), so their contents matter too.
+		if (value.get_type() == Variant::STRING && String(value).begins_with("res://") && FileAccess::exists(value)) {
+			key += FileAccess::get_sha256(value) + "\n";
+		}
+	}
+
+	return key.sha256_text();
+}
+
+String EditorImportCache::_get_entry_path(const String &p_key) const {
+	return cache_dir.path_join(p_key.substr(0, 2)).path_join(p_key);
+}
+
+bool EditorImportCache::load(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, List<String> *r_import_variants, Variant *r_meta) const {
+	String cache_path = _get_entry_path(p_key);
+
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(cache_path.path_join("import.cfg")) != OK) {
+		return false;
+	}
+
+	Vector<String> variants = cf->get_value("import", "variants", Vector<String>());
+	Vector<String> suffixes;
+	if (variants.is_empty()) {
+		suffixes.push_back(p_importer->get_save_extension());
+	} else {
+		for (const String &E : variants) {
+			suffixes.push_back(E + "." + p_importer->get_save_extension());
+		}
+	}
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	for (const String &E : suffixes) {
+		String dest_path = ProjectSettings::get_singleton()->globalize_path(p_base_path + "." + E);
+		if (da->copy(cache_path.path_join(E), dest_path) != OK) {
+			return false;
+		}
+	}
+
+	for (const String &E : variants) {
+		r_import_variants->push_back(E);
+	}
+	*r_meta = cf->get_value("import", "metadata", Variant());
+
+	// evict() goes by the modification time of this file, so saving it again marks the entry as used.
+	cf->save(cache_path.path_join("import.cfg"));
+	return true;
+}
+
+void EditorImportCache::save(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_import_variants, const Variant &p_meta) const {
+	String cache_path = _get_entry_path(p_key);
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->dir_exists(cache_path)) {
+		return;
+	}
+
+	// Files are written to a temporary folder first, which is then renamed. This way another thread
+	// (or editor instance) importing an identical file never sees a partially written cache entry.
+	String temp_path = cache_path + ".tmp" + itos(Thread::get_caller_id());
+	Error err = da->make_dir_recursive(temp_path);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot create import cache folder '" + temp_path + "'.");
+
+	Vector<String> variants;
+	Vector<String> suffixes;
+	if (p_import_variants.is_empty()) {
+		suffixes.push_back(p_importer->get_save_extension());
+	} else {
+		for (const String &E : p_import_variants) {
+			variants.push_back(E);
+			suffixes.push_back(E + "." + p_importer->get_save_extension());
+		}
+	}
+
+	for (const String &E : suffixes) {
+		String src_path = ProjectSettings::get_singleton()->globalize_path(p_base_path + "." + E);
+		err = da->copy(src_path, temp_path.path_join(E));
+		if (err != OK) {
+			break;
+		}
+	}
+
+	if (err == OK) {
+		Ref<ConfigFile> cf;
+		cf.instantiate();
+		cf->set_value("import", "variants", variants);
+		cf->set_value("import", "metadata", p_meta);
+		err = cf->save(temp_path.path_join("import.cfg"));
+	}
+
+	if (err == OK) {
+		err = da->rename(temp_path, cache_path);
+	}
+
+	if (err != OK) {
+		// Either something failed, or the same entry was just stored by someone else.
+		Ref<DirAccess> temp_da = DirAccess::open(temp_path);
+		if (temp_da.is_valid()) {
+			temp_da->erase_contents_recursive();
+		}
+		da->remove(temp_path);
+	}
+}
+
+// Removes the least recently used entries until the cache takes at most p_max_size bytes.
+void EditorImportCache::evict(uint64_t p_max_size) const {
+	struct Entry {
+		String path;
+		uint64_t last_used = 0;
+		uint64_t size = 0;
+
+		bool operator<(const Entry &p_other) const { return last_used < p_other.last_used; }
+	};
+
+	if (!DirAccess::dir_exists_absolute(cache_dir)) {
+		return;
+	}
+
+	Vector<Entry> entries;
+	uint64_t total_size = 0;
+
+	PackedStringArray buckets = DirAccess::get_directories_at(cache_dir);
+	for (const String &bucket : buckets) {
+		String bucket_path = cache_dir.path_join(bucket);
+		PackedStringArray keys = DirAccess::get_directories_at(bucket_path);
+		for (const String &key : keys) {
+			if (key.contains(".tmp")) {
+				continue; // Being written by an import.
+			}
+
+			Entry entry;
+			entry.path = bucket_path.path_join(key);
+			entry.last_used = FileAccess::get_modified_time(entry.path.path_join("import.cfg"));
+
+			PackedStringArray files = DirAccess::get_files_at(entry.path);
+			for (const String &file : files) {
+				Ref<FileAccess> f = FileAccess::open(entry.path.path_join(file), FileAccess::READ);
+				if (f.is_valid()) {
+					entry.size += f->get_length();
+				}
+			}
+
+			total_size += entry.size;
+			entries.push_back(entry);
+		}
+	}
+
+	if (total_size <= p_max_size) {
+		return;
+	}
+
+	entries.sort();
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	for (int i = 0; i < entries.size() && total_size > p_max_size; i++) {
+		Ref<DirAccess> entry_da = DirAccess::open(entries[i].path);
+		if (entry_da.is_valid()) {
+			entry_da->erase_contents_recursive();
+		}
+		if (da->remove(entries[i].path) == OK) {
+			total_size -= entries[i].size;
+		}
+	}
+}
@@ -0,0 +1,57 @@
+/*************************************************************************/
+/*  editor_import_cache.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef EDITOR_IMPORT_CACHE_H
+#define EDITOR_IMPORT_CACHE_H
+
+#include "core/io/resource_importer.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+
+// Stores the files created by importers under a key computed from the source file contents and
+// the import options, so importing an identical file again only copies them back.
+// Only imports from importers returning true from ResourceImporter::can_cache_import() are cached.
+class EditorImportCache {
+	String cache_dir;
+
+	String _get_entry_path(const String &p_key) const;
+
+public:
+	static String get_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const HashMap<StringName, Variant> &p_params);
+
+	bool load(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, List<String> *r_import_variants, Variant *r_meta) const;
+	void save(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_import_variants, const Variant &p_meta) const;
+	void evict(uint64_t p_max_size) const;
+
+	void set_cache_dir(const String &p_dir) { cache_dir = p_dir; }
+	String get_cache_dir() const { return cache_dir; }
+};
+
+#endif // EDITOR_IMPORT_CACHE_H
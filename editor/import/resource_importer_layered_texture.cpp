@@ -425,6 +425,13 @@ String ResourceImporterLayeredTexture::get_import_settings_string() const {
 		index++;
 	}
 
+	// Lossless compressed textures are stored as PNG instead of WebP when this is enabled.
+	// Only added when it differs from the default, so projects that don't change it keep their import settings hash.
+	const String force_png_setting = "rendering/textures/lossless_compression/force_png";
+	if (GLOBAL_GET(force_png_setting) != ProjectSettings::get_singleton()->property_get_revert(force_png_setting)) {
+		s += "force_png";
+	}
+
 	return s;
 }
 
@@ -32,6 +32,7 @@
 
 #include "core/error/error_macros.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "editor/editor_node.h"
 #include "editor/import/scene_import_settings.h"
 #include "scene/3d/area_3d.h"
@@ -1921,145 +1922,176 @@ Array ResourceImporterScene::_get_skinned_pose_transforms(ImporterMeshInstance3D
 	return skin_pose_transform_array;
 }
 
-void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+void ResourceImporterScene::_collect_mesh_jobs(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches, MeshProcessJobs &r_jobs) {
 	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
-	if (src_mesh_node) {
-		//is mesh
-		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
-		mesh_node->set_name(src_mesh_node->get_name());
-		mesh_node->set_transform(src_mesh_node->get_transform());
-		mesh_node->set_skin(src_mesh_node->get_skin());
-		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
-		if (src_mesh_node->get_mesh().is_valid()) {
-			Ref<ArrayMesh> mesh;
-			if (!src_mesh_node->get_mesh()->has_mesh()) {
-				//do mesh processing
+	if (src_mesh_node && src_mesh_node->get_mesh().is_valid() && !src_mesh_node->get_mesh()->has_mesh() && !r_jobs.indices.has(src_mesh_node->get_mesh())) {
+		//do mesh processing
+
+		MeshProcessJob job;
+		job.mesh = src_mesh_node->get_mesh();
+		job.generate_lods = p_generate_lods;
+		job.create_shadow_mesh = p_create_shadow_meshes;
+		bool bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
+
+		String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
+
+		if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
+			Dictionary mesh_settings = p_mesh_data[mesh_id];
+			{
+				//fill node settings for this node with default values
+				List<ImportOption> iopts;
+				get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
+				for (const ImportOption &E : iopts) {
+					if (!mesh_settings.has(E.option.name)) {
+						mesh_settings[E.option.name] = E.default_value;
+					}
+				}
+			}
 
-				bool generate_lods = p_generate_lods;
-				float split_angle = 25.0f;
-				float merge_angle = 60.0f;
-				bool create_shadow_meshes = p_create_shadow_meshes;
-				bool bake_lightmaps = p_light_bake_mode == LIGHT_BAKE_STATIC_LIGHTMAPS;
-				String save_to_file;
+			if (mesh_settings.has("generate/shadow_meshes")) {
+				int shadow_meshes = mesh_settings["generate/shadow_meshes"];
+				if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
+					job.create_shadow_mesh = true;
+				} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
+					job.create_shadow_mesh = false;
+				}
+			}
 
-				String mesh_id = src_mesh_node->get_mesh()->get_meta("import_id", src_mesh_node->get_mesh()->get_name());
+			if (mesh_settings.has("generate/lightmap_uv")) {
+				int lightmap_uv = mesh_settings["generate/lightmap_uv"];
+				if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
+					bake_lightmaps = true;
+				} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
+					bake_lightmaps = false;
+				}
+			}
 
-				if (!mesh_id.is_empty() && p_mesh_data.has(mesh_id)) {
-					Dictionary mesh_settings = p_mesh_data[mesh_id];
-					{
-						//fill node settings for this node with default values
-						List<ImportOption> iopts;
-						get_internal_import_options(INTERNAL_IMPORT_CATEGORY_MESH, &iopts);
-						for (const ImportOption &E : iopts) {
-							if (!mesh_settings.has(E.option.name)) {
-								mesh_settings[E.option.name] = E.default_value;
-							}
-						}
-					}
+			if (mesh_settings.has("generate/lods")) {
+				int lods = mesh_settings["generate/lods"];
+				if (lods == MESH_OVERRIDE_ENABLE) {
+					job.generate_lods = true;
+				} else if (lods == MESH_OVERRIDE_DISABLE) {
+					job.generate_lods = false;
+				}
+			}
 
-					if (mesh_settings.has("generate/shadow_meshes")) {
-						int shadow_meshes = mesh_settings["generate/shadow_meshes"];
-						if (shadow_meshes == MESH_OVERRIDE_ENABLE) {
-							create_shadow_meshes = true;
-						} else if (shadow_meshes == MESH_OVERRIDE_DISABLE) {
-							create_shadow_meshes = false;
-						}
-					}
+			if (mesh_settings.has("lods/normal_split_angle")) {
+				job.split_angle = mesh_settings["lods/normal_split_angle"];
+			}
 
-					if (mesh_settings.has("generate/lightmap_uv")) {
-						int lightmap_uv = mesh_settings["generate/lightmap_uv"];
-						if (lightmap_uv == MESH_OVERRIDE_ENABLE) {
-							bake_lightmaps = true;
-						} else if (lightmap_uv == MESH_OVERRIDE_DISABLE) {
-							bake_lightmaps = false;
-						}
-					}
+			if (mesh_settings.has("lods/normal_merge_angle")) {
+				job.merge_angle = mesh_settings["lods/normal_merge_angle"];
+			}
 
-					if (mesh_settings.has("generate/lods")) {
-						int lods = mesh_settings["generate/lods"];
-						if (lods == MESH_OVERRIDE_ENABLE) {
-							generate_lods = true;
-						} else if (lods == MESH_OVERRIDE_DISABLE) {
-							generate_lods = false;
-						}
-					}
+			if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
+				job.save_to_file = mesh_settings["save_to_file/path"];
+				if (!job.save_to_file.is_resource_file()) {
+					job.save_to_file = "";
+				}
+			}
 
-					if (mesh_settings.has("lods/normal_split_angle")) {
-						split_angle = mesh_settings["lods/normal_split_angle"];
-					}
+			for (int i = 0; i < post_importer_plugins.size(); i++) {
+				post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
+			}
+		}
 
-					if (mesh_settings.has("lods/normal_merge_angle")) {
-						merge_angle = mesh_settings["lods/normal_merge_angle"];
-					}
+		if (bake_lightmaps) {
+			// xatlas already spreads the unwrap over its own threads, so meshes are unwrapped one after the other.
+			// This also keeps the order in which lightmap caches are merged stable.
+			uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+
+			Transform3D xf;
+			Node3D *n = src_mesh_node;
+			while (n) {
+				xf = n->get_transform() * xf;
+				n = n->get_parent_node_3d();
+			}
+
+			Vector<uint8_t> lightmap_cache;
+			src_mesh_node->get_mesh()->lightmap_unwrap_cached(xf, p_lightmap_texel_size, p_src_lightmap_cache, lightmap_cache);
 
-					if (mesh_settings.has("save_to_file/enabled") && bool(mesh_settings["save_to_file/enabled"]) && mesh_settings.has("save_to_file/path")) {
-						save_to_file = mesh_settings["save_to_file/path"];
-						if (!save_to_file.is_resource_file()) {
-							save_to_file = "";
+			if (!lightmap_cache.is_empty()) {
+				if (r_lightmap_caches.is_empty()) {
+					r_lightmap_caches.push_back(lightmap_cache);
+				} else {
+					String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
+
+					for (int i = 0; i < r_lightmap_caches.size(); i++) {
+						String md5 = String::md5(r_lightmap_caches[i].ptr());
+						if (new_md5 < md5) {
+							r_lightmap_caches.insert(i, lightmap_cache);
+							break;
 						}
-					}
 
-					for (int i = 0; i < post_importer_plugins.size(); i++) {
-						post_importer_plugins.write[i]->internal_process(EditorScenePostImportPlugin::INTERNAL_IMPORT_CATEGORY_MESH, nullptr, src_mesh_node, src_mesh_node->get_mesh(), mesh_settings);
+						if (new_md5 == md5) {
+							break;
+						}
 					}
 				}
+			}
 
-				if (bake_lightmaps) {
-					Transform3D xf;
-					Node3D *n = src_mesh_node;
-					while (n) {
-						xf = n->get_transform() * xf;
-						n = n->get_parent_node_3d();
-					}
+			r_jobs.lightmap_unwrap_usec += OS::get_singleton()->get_ticks_usec() - begin_time;
+		}
 
-					Vector<uint8_t> lightmap_cache;
-					src_mesh_node->get_mesh()->lightmap_unwrap_cached(xf, p_lightmap_texel_size, p_src_lightmap_cache, lightmap_cache);
+		if (job.generate_lods) {
+			// Depends on the skeleton in the tree, so it can't be queried from the jobs.
+			job.skin_pose_transforms = _get_skinned_pose_transforms(src_mesh_node);
+		}
 
-					if (!lightmap_cache.is_empty()) {
-						if (r_lightmap_caches.is_empty()) {
-							r_lightmap_caches.push_back(lightmap_cache);
-						} else {
-							String new_md5 = String::md5(lightmap_cache.ptr()); // MD5 is stored at the beginning of the cache data
+		r_jobs.indices.insert(job.mesh, r_jobs.jobs.size());
+		r_jobs.jobs.push_back(job);
+	}
 
-							for (int i = 0; i < r_lightmap_caches.size(); i++) {
-								String md5 = String::md5(r_lightmap_caches[i].ptr());
-								if (new_md5 < md5) {
-									r_lightmap_caches.insert(i, lightmap_cache);
-									break;
-								}
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_collect_mesh_jobs(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches, r_jobs);
+	}
+}
 
-								if (new_md5 == md5) {
-									break;
-								}
-							}
-						}
-					}
-				}
+void ResourceImporterScene::_process_mesh_job(void *p_userdata, uint32_t p_index) {
+	MeshProcessJob &job = static_cast<MeshProcessJobs *>(p_userdata)->jobs[p_index];
 
-				if (generate_lods) {
-					Array skin_pose_transform_array = _get_skinned_pose_transforms(src_mesh_node);
-					src_mesh_node->get_mesh()->generate_lods(merge_angle, split_angle, skin_pose_transform_array);
-				}
+	// Each job only touches its own mesh, so the result doesn't depend on which thread runs it.
+	if (job.generate_lods) {
+		uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+		job.mesh->generate_lods(job.merge_angle, job.split_angle, job.skin_pose_transforms);
+		job.lods_usec = OS::get_singleton()->get_ticks_usec() - begin_time;
+	}
 
-				if (create_shadow_meshes) {
-					src_mesh_node->get_mesh()->create_shadow_mesh();
-				}
+	if (job.create_shadow_mesh) {
+		uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+		job.mesh->create_shadow_mesh();
+		job.shadow_mesh_usec = OS::get_singleton()->get_ticks_usec() - begin_time;
+	}
+}
 
-				if (!save_to_file.is_empty()) {
-					Ref<Mesh> existing = ResourceCache::get_ref(save_to_file);
-					if (existing.is_valid()) {
-						//if somehow an existing one is useful, create
-						existing->reset_state();
-					}
-					mesh = src_mesh_node->get_mesh()->get_mesh(existing);
+void ResourceImporterScene::_replace_mesh_nodes(Node *p_node, LightBakeMode p_light_bake_mode, MeshProcessJobs &r_jobs) {
+	ImporterMeshInstance3D *src_mesh_node = Object::cast_to<ImporterMeshInstance3D>(p_node);
+	if (src_mesh_node) {
+		//is mesh
+		MeshInstance3D *mesh_node = memnew(MeshInstance3D);
+		mesh_node->set_name(src_mesh_node->get_name());
+		mesh_node->set_transform(src_mesh_node->get_transform());
+		mesh_node->set_skin(src_mesh_node->get_skin());
+		mesh_node->set_skeleton_path(src_mesh_node->get_skeleton_path());
+		if (src_mesh_node->get_mesh().is_valid()) {
+			Ref<ArrayMesh> mesh;
+			HashMap<Ref<ImporterMesh>, uint32_t>::ConstIterator E = r_jobs.indices.find(src_mesh_node->get_mesh());
+			if (!src_mesh_node->get_mesh()->has_mesh() && E && !r_jobs.jobs[E->value].save_to_file.is_empty()) {
+				uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+				const String &save_to_file = r_jobs.jobs[E->value].save_to_file;
+
+				Ref<Mesh> existing = ResourceCache::get_ref(save_to_file);
+				if (existing.is_valid()) {
+					//if somehow an existing one is useful, create
+					existing->reset_state();
+				}
+				mesh = src_mesh_node->get_mesh()->get_mesh(existing);
 
-					ResourceSaver::save(mesh, save_to_file); //override
+				ResourceSaver::save(mesh, save_to_file); //override
 
-					mesh->set_path(save_to_file, true); //takeover existing, if needed
+				mesh->set_path(save_to_file, true); //takeover existing, if needed
 
-				} else {
-					mesh = src_mesh_node->get_mesh()->get_mesh();
-				}
+				r_jobs.save_usec += OS::get_singleton()->get_ticks_usec() - begin_time;
 			} else {
 				mesh = src_mesh_node->get_mesh()->get_mesh();
 			}
@@ -2091,10 +2123,45 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_m
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches);
+		_replace_mesh_nodes(p_node->get_child(i), p_light_bake_mode, r_jobs);
 	}
 }
 
+void ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches) {
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+
+	// Settings, import plugins and lightmap unwrapping run on this thread, in tree order.
+	MeshProcessJobs jobs;
+	_collect_mesh_jobs(p_node, p_mesh_data, p_generate_lods, p_create_shadow_meshes, p_light_bake_mode, p_lightmap_texel_size, p_src_lightmap_cache, r_lightmap_caches, jobs);
+
+	// LOD and shadow mesh generation are independent for every mesh, so they run in parallel.
+	uint64_t process_begin_time = OS::get_singleton()->get_ticks_usec();
+	if (jobs.jobs.size() > 1 && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_process_mesh_job, &jobs, jobs.jobs.size(), -1, true, SNAME("SceneImportMeshes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < jobs.jobs.size(); i++) {
+			_process_mesh_job(&jobs, i);
+		}
+	}
+	uint64_t process_usec = OS::get_singleton()->get_ticks_usec() - process_begin_time;
+
+	// Nodes can only be replaced on this thread.
+	_replace_mesh_nodes(p_node, p_light_bake_mode, jobs);
+
+	uint64_t lods_usec = 0;
+	uint64_t shadow_mesh_usec = 0;
+	for (uint32_t i = 0; i < jobs.jobs.size(); i++) {
+		lods_usec += jobs.jobs[i].lods_usec;
+		shadow_mesh_usec += jobs.jobs[i].shadow_mesh_usec;
+	}
+
+	print_verbose(vformat("Scene import: processed %d meshes in %.2f ms.", jobs.jobs.size(), (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000.0));
+	print_verbose(vformat("  Lightmap UV2 unwrap: %.2f ms.", jobs.lightmap_unwrap_usec / 1000.0));
+	print_verbose(vformat("  LOD generation: %.2f ms, shadow meshes: %.2f ms (%.2f ms wall time).", lods_usec / 1000.0, shadow_mesh_usec / 1000.0, process_usec / 1000.0));
+	print_verbose(vformat("  Saving meshes: %.2f ms.", jobs.save_usec / 1000.0));
+}
+
 void ResourceImporterScene::_add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes) {
 	for (const Ref<Shape3D> &E : p_shapes) {
 		CollisionShape3D *cshape = memnew(CollisionShape3D);
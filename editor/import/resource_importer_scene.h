@@ -33,6 +33,8 @@
 
 #include "core/error/error_macros.h"
 #include "core/io/resource_importer.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/dictionary.h"
 #include "scene/3d/importer_mesh_instance_3d.h"
 #include "scene/resources/animation.h"
@@ -213,6 +215,31 @@ class ResourceImporterScene : public ResourceImporter {
 
 	Array _get_skinned_pose_transforms(ImporterMeshInstance3D *p_src_mesh_node);
 	void _replace_owner(Node *p_node, Node *p_scene, Node *p_new_owner);
+
+	struct MeshProcessJob {
+		Ref<ImporterMesh> mesh;
+		bool generate_lods = false;
+		bool create_shadow_mesh = false;
+		float split_angle = 25.0f;
+		float merge_angle = 60.0f;
+		Array skin_pose_transforms;
+		String save_to_file;
+
+		uint64_t lods_usec = 0;
+		uint64_t shadow_mesh_usec = 0;
+	};
+
+	struct MeshProcessJobs {
+		LocalVector<MeshProcessJob> jobs;
+		HashMap<Ref<ImporterMesh>, uint32_t> indices;
+
+		uint64_t lightmap_unwrap_usec = 0;
+		uint64_t save_usec = 0;
+	};
+
+	void _collect_mesh_jobs(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches, MeshProcessJobs &r_jobs);
+	static void _process_mesh_job(void *p_userdata, uint32_t p_index);
+	void _replace_mesh_nodes(Node *p_node, LightBakeMode p_light_bake_mode, MeshProcessJobs &r_jobs);
 	void _generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
 	void _add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes);
 
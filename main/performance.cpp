@@ -35,6 +35,7 @@
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene.h"
 #include "servers/audio_server.h"
 #include "servers/physics_server_2d.h"
 #include "servers/physics_server_3d.h"
@@ -74,6 +75,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(OBJECT_POOLED_SCENE_INSTANCE_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_POOLED_SCENE_NODE_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_SCENE_POOL_MISSES);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -113,6 +118,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"object/pooled_scene_instances",
+		"object/pooled_scene_nodes",
+		"object/scene_pool_hits",
+		"object/scene_pool_misses",
 
 	};
 
@@ -167,6 +176,14 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case OBJECT_POOLED_SCENE_INSTANCE_COUNT:
+			return PackedScene::get_pooled_instance_count();
+		case OBJECT_POOLED_SCENE_NODE_COUNT:
+			return PackedScene::get_pooled_node_count();
+		case OBJECT_SCENE_POOL_HITS:
+			return PackedScene::get_instance_pool_hit_count();
+		case OBJECT_SCENE_POOL_MISSES:
+			return PackedScene::get_instance_pool_miss_count();
 
 		default: {
 		}
@@ -202,6 +219,10 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
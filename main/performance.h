@@ -89,6 +89,10 @@ public:
 		PHYSICS_3D_COLLISION_PAIRS,
 		PHYSICS_3D_ISLAND_COUNT,
 		AUDIO_OUTPUT_LATENCY,
+		OBJECT_POOLED_SCENE_INSTANCE_COUNT,
+		OBJECT_POOLED_SCENE_NODE_COUNT,
+		OBJECT_SCENE_POOL_HITS,
+		OBJECT_SCENE_POOL_MISSES,
 		MONITOR_MAX
 	};
 
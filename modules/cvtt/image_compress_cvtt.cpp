@@ -30,10 +30,10 @@
 
 #include "image_compress_cvtt.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/os/thread.h"
 #include "core/string/print_string.h"
-#include "core/templates/safe_refcount.h"
 
 #include <ConvectionKernels.h>
 
@@ -57,7 +57,6 @@ struct CVTTCompressionJobQueue {
 	CVTTCompressionJobParams job_params;
 	const CVTTCompressionRowTask *job_tasks = nullptr;
 	uint32_t num_tasks = 0;
-	SafeNumeric<uint32_t> current_task;
 };
 
 static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const CVTTCompressionRowTask &p_row_task) {
@@ -129,6 +128,11 @@ static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const
 	}
 }
 
+static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
+	const CVTTCompressionJobQueue *job_queue = static_cast<const CVTTCompressionJobQueue *>(p_job_queue);
+	_digest_row_task(job_queue->job_params, job_queue->job_tasks[p_index]);
+}
+
 void image_compress_cvtt(Image *p_image, float p_lossy_quality, Image::UsedChannels p_channels) {
 	if (p_image->get_format() >= Image::FORMAT_BPTC_RGBA) {
 		return; //do not compress, already compressed
@@ -220,7 +224,7 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, Image::UsedChann
 			row_task.in_mm_bytes = in_bytes;
 			row_task.out_mm_bytes = out_bytes;
 
-			_digest_row_task(job_queue.job_params, row_task);
+			tasks.push_back(row_task);
 
 			out_bytes += 16 * (bw / 4);
 		}
@@ -230,6 +234,22 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, Image::UsedChann
 		h = MAX(h / 2, 1);
 	}
 
+	// Every row of blocks is written to its own range of the output, so rows from all the mipmaps
+	// can be compressed in any order and the result is the same as compressing them one by one.
+	job_queue.job_tasks = tasks.ptr();
+	job_queue.num_tasks = static_cast<uint32_t>(tasks.size());
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Compressing from a worker thread (e.g. a threaded import) stays serial, see _process_ranges() in Image.
+	if (job_queue.num_tasks > 1 && pool && pool->get_thread_count() > 1 && Thread::get_caller_id() == Thread::get_main_id()) {
+		WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_digest_job_queue, &job_queue, job_queue.num_tasks, -1, true, SNAME("CVTTCompress"));
+		pool->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < job_queue.num_tasks; i++) {
+			_digest_row_task(job_queue.job_params, tasks[i]);
+		}
+	}
+
 	p_image->set_data(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
 }
 
@@ -0,0 +1,68 @@
+/*************************************************************************/
+/*  test_image_compress_cvtt.h                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_IMAGE_COMPRESS_CVTT_H
+#define TEST_IMAGE_COMPRESS_CVTT_H
+
+#include "core/os/thread.h"
+#include "modules/cvtt/image_compress_cvtt.h"
+
+#include "tests/test_macros.h"
+
+namespace TestImageCompressCVTT {
+
+static void _compress_thread(void *p_userdata) {
+	image_compress_cvtt((Image *)p_userdata, 0.7, Image::USED_CHANNELS_RGBA);
+}
+
+TEST_CASE("[CVTT] Compressing on the main thread matches the serial path") {
+	Vector<uint8_t> data;
+	data.resize(256 * 256 * 4);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i * 5 + (i / 1024) * 11) & 0xFF;
+	}
+	Ref<Image> parallel = Image::create_from_data(256, 256, false, Image::FORMAT_RGBA8, data);
+	parallel->generate_mipmaps();
+	Ref<Image> serial = parallel->duplicate();
+
+	// Rows are only compressed on the WorkerThreadPool when called from the main thread.
+	image_compress_cvtt(parallel.ptr(), 0.7, Image::USED_CHANNELS_RGBA);
+	Thread thread;
+	thread.start(_compress_thread, serial.ptr());
+	thread.wait_to_finish();
+
+	CHECK(parallel->get_format() == Image::FORMAT_BPTC_RGBA);
+	CHECK(parallel->get_data() == serial->get_data());
+}
+
+} // namespace TestImageCompressCVTT
+
+#endif // TEST_IMAGE_COMPRESS_CVTT_H
@@ -30,7 +30,9 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 
 #include "thirdparty/etcpak/ProcessDxtc.hpp"
@@ -88,6 +90,43 @@ void _compress_bc(Image *r_img, float p_lossy_quality, Image::UsedChannels p_cha
 	_compress_etcpak(type, r_img, p_lossy_quality);
 }
 
+// Blocks are independent from each other, so each mipmap is split in jobs of a few block rows
+// which are compressed in parallel. The output doesn't depend on how the jobs are scheduled.
+#define ETCPAK_BLOCK_ROWS_PER_JOB 8
+
+struct EtcpakCompressionJob {
+	const uint32_t *src = nullptr; // First pixel of the first block row.
+	uint64_t *dst = nullptr; // First block of the first block row.
+	uint32_t blocks = 0;
+	int width = 0; // Padded width of the mipmap, in pixels.
+};
+
+struct EtcpakCompressionJobQueue {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const EtcpakCompressionJob *jobs = nullptr;
+};
+
+static void _compress_etcpak_job(EtcpakType p_compresstype, const EtcpakCompressionJob &p_job) {
+	if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
+		CompressEtc1RgbDither(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
+		CompressEtc2Rgb(p_job.src, p_job.dst, p_job.blocks, p_job.width, true);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
+		CompressEtc2Rgba(p_job.src, p_job.dst, p_job.blocks, p_job.width, true);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
+		CompressDxt1Dither(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+	} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
+		CompressDxt5(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+	} else {
+		ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
+	}
+}
+
+static void _compress_etcpak_job_task(void *p_userdata, uint32_t p_index) {
+	const EtcpakCompressionJobQueue *job_queue = (const EtcpakCompressionJobQueue *)p_userdata;
+	_compress_etcpak_job(job_queue->type, job_queue->jobs[p_index]);
+}
+
 void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_quality) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -175,7 +214,15 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 	uint8_t *dest_write = dest_data.ptrw();
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	// Padded copies of the mipmaps that need one, kept until all the jobs are done.
+	Vector<Vector<uint32_t>> padded_mips;
+	padded_mips.resize(mip_count + 1);
+
+	// DXT5 and ETC2 with alpha use 16 bytes per block, the other formats 8 bytes.
+	const bool has_alpha_block = p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG;
+	const int block_words = has_alpha_block ? 2 : 1;
+
+	Vector<EtcpakCompressionJob> jobs;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -188,7 +235,6 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -196,6 +242,7 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 
 		// Pad textures to nearest block by smearing.
 		if (mip_w != orig_mip_w || mip_h != orig_mip_h) {
+			Vector<uint32_t> &padded_src = padded_mips.write[i];
 			padded_src.resize(mip_w * mip_h);
 			uint32_t *ptrw = padded_src.ptrw();
 			int x = 0, y = 0;
@@ -217,18 +264,32 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img, float p_lossy_qua
 			// Override the src_mip_read pointer to our temporary Vector.
 			src_mip_read = padded_src.ptr();
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else {
-			ERR_FAIL_MSG("Invalid or unsupported Etcpak compression format.");
+
+		const int blocks_per_row = mip_w / 4;
+		const int block_rows = mip_h / 4;
+		for (int row = 0; row < block_rows; row += ETCPAK_BLOCK_ROWS_PER_JOB) {
+			EtcpakCompressionJob job;
+			job.src = src_mip_read + row * 4 * mip_w;
+			job.dst = dest_mip_write + row * blocks_per_row * block_words;
+			job.blocks = MIN(ETCPAK_BLOCK_ROWS_PER_JOB, block_rows - row) * blocks_per_row;
+			job.width = mip_w;
+			jobs.push_back(job);
+		}
+	}
+
+	EtcpakCompressionJobQueue job_queue;
+	job_queue.type = p_compresstype;
+	job_queue.jobs = jobs.ptr();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Like Image, only split work coming from the main thread, so importers compressing on
+	// worker threads don't wait on a group that needs the workers they are holding.
+	if (jobs.size() > 1 && pool && pool->get_thread_count() > 1 && Thread::get_caller_id() == Thread::get_main_id()) {
+		WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_compress_etcpak_job_task, &job_queue, jobs.size(), -1, true, SNAME("EtcpakCompress"));
+		pool->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < jobs.size(); i++) {
+			_compress_etcpak_job(p_compresstype, jobs[i]);
 		}
 	}
 
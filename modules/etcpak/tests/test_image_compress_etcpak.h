@@ -0,0 +1,75 @@
+/*************************************************************************/
+/*  test_image_compress_etcpak.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_IMAGE_COMPRESS_ETCPAK_H
+#define TEST_IMAGE_COMPRESS_ETCPAK_H
+
+#include "core/os/thread.h"
+#include "modules/etcpak/image_compress_etcpak.h"
+
+#include "tests/test_macros.h"
+
+namespace TestImageCompressEtcpak {
+
+static Ref<Image> _create_test_image() {
+	Vector<uint8_t> data;
+	data.resize(512 * 512 * 4);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i * 7 + (i / 2048) * 13) & 0xFF;
+	}
+	Ref<Image> image = Image::create_from_data(512, 512, false, Image::FORMAT_RGBA8, data);
+	image->generate_mipmaps();
+	return image;
+}
+
+static void _compress_dxt5_thread(void *p_userdata) {
+	_compress_etcpak(EtcpakType::ETCPAK_TYPE_DXT5, (Image *)p_userdata, 0.7);
+}
+
+TEST_CASE("[etcpak] Compressing on the main thread matches the serial path") {
+	Ref<Image> parallel = _create_test_image();
+	Ref<Image> serial = parallel->duplicate();
+
+	// Only the main thread splits the work over the WorkerThreadPool.
+	_compress_etcpak(EtcpakType::ETCPAK_TYPE_DXT5, parallel.ptr(), 0.7);
+	Thread thread;
+	thread.start(_compress_dxt5_thread, serial.ptr());
+	thread.wait_to_finish();
+
+	CHECK(parallel->get_format() == Image::FORMAT_DXT5);
+	CHECK(serial->get_format() == Image::FORMAT_DXT5);
+	CHECK(parallel->has_mipmaps());
+	CHECK(parallel->get_data() == serial->get_data());
+}
+
+} // namespace TestImageCompressEtcpak
+
+#endif // TEST_IMAGE_COMPRESS_ETCPAK_H
@@ -44,6 +44,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_warning.h"
 
 #ifdef TESTS_ENABLED
@@ -436,11 +437,17 @@ void GDScript::set_source_code(const String &p_code) {
 		return;
 	}
 	source = p_code;
+	binary_tokens.clear();
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
 #endif
 }
 
+void GDScript::set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens) {
+	binary_tokens = p_binary_tokens;
+	source = String();
+}
+
 #ifdef TOOLS_ENABLED
 void GDScript::_update_exports_values(HashMap<StringName, Variant> &values, List<PropertyInfo> &propnames) {
 	for (const KeyValue<StringName, Variant> &E : member_default_values_cache) {
@@ -882,7 +889,7 @@ Error GDScript::reload(bool p_keep_state) {
 
 	valid = false;
 	GDScriptParser parser;
-	Error err = parser.parse(source, path, false);
+	Error err = binary_tokens.is_empty() ? parser.parse(source, path, false) : parser.parse_binary(binary_tokens, path);
 	if (err) {
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
@@ -1042,7 +1049,10 @@ void GDScript::_bind_methods() {
 }
 
 Vector<uint8_t> GDScript::get_as_byte_code() const {
-	return Vector<uint8_t>();
+	if (!binary_tokens.is_empty()) {
+		return binary_tokens;
+	}
+	return GDScriptTokenizer::parse_code_string(source);
 };
 
 // TODO: Fully remove this. There's not this kind of "bytecode" anymore.
@@ -1091,6 +1101,15 @@ Error GDScript::load_source_code(const String &p_path) {
 	return OK;
 }
 
+Error GDScript::load_binary_tokens(const String &p_path) {
+	Error err;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_array(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err, err, "Attempt to open script '" + p_path + "' resulted in error '" + error_names[err] + "'.");
+
+	set_binary_tokens_source(buffer);
+	return OK;
+}
+
 const HashMap<StringName, GDScriptFunction *> &GDScript::debug_get_member_functions() const {
 	return member_functions;
 }
@@ -1188,6 +1207,8 @@ String GDScript::_get_gdscript_reference_class_name(const GDScript *p_gdscript)
 	return class_name;
 }
 
+SafeNumeric<uint32_t> GDScript::last_member_cache_id;
+
 GDScript::GDScript() :
 		script_list(this) {
 #ifdef DEBUG_ENABLED
@@ -1312,6 +1333,10 @@ GDScript::~GDScript() {
 //////////////////////////////
 
 bool GDScriptInstance::set(const StringName &p_name, const Variant &p_value) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_V_MSG(!is_accessible_from_caller_thread(), false, vformat("Cannot set \"%s\" from a thread-safe function, as the instance belongs to another thread.", p_name));
+#endif
+
 	//member
 	{
 		HashMap<StringName, GDScript::MemberInfo>::Iterator E = script->member_indices.find(p_name);
@@ -1375,6 +1400,10 @@ bool GDScriptInstance::set(const StringName &p_name, const Variant &p_value) {
 }
 
 bool GDScriptInstance::get(const StringName &p_name, Variant &r_ret) const {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_V_MSG(!is_accessible_from_caller_thread(), false, vformat("Cannot get \"%s\" from a thread-safe function, as the instance belongs to another thread.", p_name));
+#endif
+
 	const GDScript *sptr = script.ptr();
 	while (sptr) {
 		{
@@ -1744,6 +1773,10 @@ GDScriptInstance::~GDScriptInstance() {
 /************* SCRIPT LANGUAGE **************/
 
 GDScriptLanguage *GDScriptLanguage::singleton = nullptr;
+thread_local int GDScriptLanguage::_debug_parse_err_line = -1;
+thread_local String GDScriptLanguage::_debug_parse_err_file;
+thread_local String GDScriptLanguage::_debug_error;
+thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
 
 String GDScriptLanguage::get_name() const {
 	return "GDScript";
@@ -1807,6 +1840,13 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+#ifdef DEBUG_ENABLED
+	String sampling_output_file = GLOBAL_GET("debug/gdscript/profiler/sampling_output_file");
+	if (!sampling_output_file.is_empty() && !Engine::get_singleton()->is_editor_hint()) {
+		GDScriptSamplingProfiler::start(sampling_output_file, int(GLOBAL_GET("debug/gdscript/profiler/sampling_interval_usec")));
+	}
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -1826,6 +1866,9 @@ Error GDScriptLanguage::execute_file(const String &p_path) {
 }
 
 void GDScriptLanguage::finish() {
+#ifdef DEBUG_ENABLED
+	GDScriptSamplingProfiler::stop();
+#endif
 }
 
 void GDScriptLanguage::profiling_start() {
@@ -2299,31 +2342,27 @@ GDScriptLanguage::GDScriptLanguage() {
 	strings._property_can_revert = StaticCString::create("_property_can_revert");
 	strings._property_get_revert = StaticCString::create("_property_get_revert");
 	strings._script_source = StaticCString::create("script/source");
-	_debug_parse_err_line = -1;
-	_debug_parse_err_file = "";
-
 	profiling = false;
 	script_frame_time = 0;
 
-	_debug_call_stack_pos = 0;
 	int dmcs = GLOBAL_DEF("debug/settings/gdscript/max_call_stack", 1024);
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/max_call_stack", PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater")); //minimum is 1024
 
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
-
+		// Call stacks are allocated by each thread when it first enters a function.
 		_debug_max_call_stack = dmcs;
-		_call_stack = memnew_arr(CallLevel, _debug_max_call_stack + 1);
-
 	} else {
 		_debug_max_call_stack = 0;
-		_call_stack = nullptr;
 	}
 
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/treat_warnings_as_errors", false);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
+	GLOBAL_DEF("debug/gdscript/profiler/sampling_output_file", "");
+	GLOBAL_DEF("debug/gdscript/profiler/sampling_interval_usec", GDScriptSamplingProfiler::DEFAULT_INTERVAL_USEC);
+	ProjectSettings::get_singleton()->set_custom_property_info("debug/gdscript/profiler/sampling_interval_usec", PropertyInfo(Variant::INT, "debug/gdscript/profiler/sampling_interval_usec", PROPERTY_HINT_RANGE, "100,100000,1,or_greater"));
 	for (int i = 0; i < (int)GDScriptWarning::WARNING_MAX; i++) {
 		GDScriptWarning::Code code = (GDScriptWarning::Code)i;
 		Variant default_enabled = GDScriptWarning::get_default_value(code);
@@ -2337,9 +2376,8 @@ GDScriptLanguage::GDScriptLanguage() {
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
-	if (_call_stack) {
-		memdelete_arr(_call_stack);
-	}
+	// Other threads free their own call stack when they exit.
+	_call_stack.free();
 
 	// Clear dependencies between scripts, to ensure cyclic references are broken (to avoid leaks at exit).
 	SelfList<GDScript> *s = script_list.first();
@@ -2395,9 +2433,10 @@ Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const Str
 	}
 
 	Error err;
-	Ref<GDScript> scr = GDScriptCache::get_full_script(p_path, err, "", p_cache_mode == CACHE_MODE_IGNORE);
+	// Use the original path, so scripts remapped to binary tokens on export are cached under their source path.
+	Ref<GDScript> scr = GDScriptCache::get_full_script(p_original_path, err, "", p_cache_mode == CACHE_MODE_IGNORE);
 
-	// TODO: Reintroduce binary and encrypted scripts.
+	// TODO: Reintroduce encrypted scripts.
 
 	if (scr.is_null()) {
 		// Don't fail loading because of parsing error.
@@ -2413,8 +2452,8 @@ Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const Str
 
 void ResourceFormatLoaderGDScript::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("gd");
-	// TODO: Reintroduce binary and encrypted scripts.
-	// p_extensions->push_back("gdc");
+	p_extensions->push_back("gdc");
+	// TODO: Reintroduce encrypted scripts.
 	// p_extensions->push_back("gde");
 }
 
@@ -2424,8 +2463,8 @@ bool ResourceFormatLoaderGDScript::handles_type(const String &p_type) const {
 
 String ResourceFormatLoaderGDScript::get_resource_type(const String &p_path) const {
 	String el = p_path.get_extension().to_lower();
-	// TODO: Reintroduce binary and encrypted scripts.
-	if (el == "gd" /*|| el == "gdc" || el == "gde"*/) {
+	// TODO: Reintroduce encrypted scripts.
+	if (el == "gd" || el == "gdc" /*|| el == "gde"*/) {
 		return "GDScript";
 	}
 	return "";
@@ -2435,14 +2474,23 @@ void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<S
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
 
-	String source = file->get_as_utf8_string();
-	if (source.is_empty()) {
-		return;
-	}
-
 	GDScriptParser parser;
-	if (OK != parser.parse(source, p_path, false)) {
-		return;
+	if (p_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> buffer;
+		buffer.resize(file->get_length());
+		file->get_buffer(buffer.ptrw(), buffer.size());
+		if (OK != parser.parse_binary(buffer, p_path)) {
+			return;
+		}
+	} else {
+		String source = file->get_as_utf8_string();
+		if (source.is_empty()) {
+			return;
+		}
+
+		if (OK != parser.parse(source, p_path, false)) {
+			return;
+		}
 	}
 
 	for (const String &E : parser.get_dependencies()) {
@@ -1379,10 +1379,22 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 
 					Variant reduced;
 
+					if (all_is_constant && args.size() > 1) {
+						// Vector2i and Vector3i only hold 32-bit bounds, and a zero step must reach
+						// "range()" to raise its error, so leave those to the runtime check.
+						for (int i = 0; i < args.size(); i++) {
+							int64_t value = args[i];
+							if (value < INT32_MIN || value > INT32_MAX || (i == 2 && value == 0)) {
+								all_is_constant = false;
+								break;
+							}
+						}
+					}
+
 					if (all_is_constant) {
 						switch (args.size()) {
 							case 1:
-								reduced = (int32_t)args[0];
+								reduced = (int64_t)args[0];
 								break;
 							case 2:
 								reduced = Vector2i(args[0], args[1]);
@@ -1398,6 +1410,20 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 
 				if (p_for->list->is_constant) {
 					p_for->list->set_datatype(type_from_variant(p_for->list->reduced_value, p_for->list));
+				} else if (call->arguments.size() == 1) {
+					// Not constant, but the compiler still builds the int bound at runtime
+					// instead of calling "range()", so the loop is counted without an array.
+					GDScriptParser::DataType list_type;
+					list_type.type_source = GDScriptParser::DataType::ANNOTATED_EXPLICIT;
+					list_type.kind = GDScriptParser::DataType::BUILTIN;
+					list_type.builtin_type = Variant::INT;
+					p_for->list->set_datatype(list_type);
+				} else if (call->arguments.size() == 2 || call->arguments.size() == 3) {
+					// The compiler builds Vector2i or Vector3i bounds when they fit at runtime,
+					// and calls "range()" otherwise, so the list can be either.
+					GDScriptParser::DataType list_type;
+					list_type.kind = GDScriptParser::DataType::VARIANT;
+					p_for->list->set_datatype(list_type);
 				} else {
 					GDScriptParser::DataType list_type;
 					list_type.type_source = GDScriptParser::DataType::ANNOTATED_EXPLICIT;
@@ -2066,6 +2092,12 @@ void GDScriptAnalyzer::reduce_assignment(GDScriptParser::AssignmentNode *p_assig
 }
 
 void GDScriptAnalyzer::reduce_await(GDScriptParser::AwaitNode *p_await) {
+	GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+	if (thread_safe_function != nullptr) {
+		// The function would be resumed on whatever thread emits the signal.
+		push_error(vformat(R"*(Cannot use "await" inside the thread-safe function "%s()".)*", thread_safe_function->identifier->name), p_await);
+	}
+
 	if (p_await->to_await == nullptr) {
 		GDScriptParser::DataType await_type;
 		await_type.kind = GDScriptParser::DataType::VARIANT;
@@ -2557,6 +2589,11 @@ void GDScriptAnalyzer::reduce_call(GDScriptParser::CallNode *p_call, bool p_is_a
 			push_error(vformat(R"*(Cannot call non-static function "%s()" on the class "%s" directly. Make an instance instead.)*", p_call->function_name, base_type.to_string()), p_call);
 		} else if (is_self && !is_static) {
 			mark_lambda_use_self();
+
+			GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+			if (thread_safe_function != nullptr && !is_thread_safe_method(base_type, p_call->function_name)) {
+				push_error(vformat(R"*(Cannot call function "%s()" from the thread-safe function "%s()", as it isn't marked "@thread_safe".)*", p_call->function_name, thread_safe_function->identifier->name), p_call);
+			}
 		}
 
 #ifdef DEBUG_ENABLED
@@ -2703,6 +2740,11 @@ void GDScriptAnalyzer::reduce_get_node(GDScriptParser::GetNodeNode *p_get_node)
 
 	mark_lambda_use_self();
 
+	GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+	if (thread_safe_function != nullptr) {
+		push_error(vformat(R"*(Cannot use shorthand "get_node()" notation ("$") inside the thread-safe function "%s()".)*", thread_safe_function->identifier->name), p_get_node);
+	}
+
 	p_get_node->set_datatype(result);
 }
 
@@ -2869,6 +2911,21 @@ void GDScriptAnalyzer::reduce_identifier_from_base(GDScriptParser::IdentifierNod
 				case GDScriptParser::ClassNode::Member::FUNCTION:
 					resolve_function_signature(member.function);
 					p_identifier->set_datatype(make_callable_type(member.function->info));
+					if (p_base == nullptr && !member.function->is_static && !member.function->is_thread_safe) {
+						// The callable is bound to "self".
+						GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+						if (thread_safe_function != nullptr) {
+							push_error(vformat(R"*(Cannot use function "%s()" from the thread-safe function "%s()", as it isn't marked "@thread_safe".)*", name, thread_safe_function->identifier->name), p_identifier);
+						}
+					}
+					break;
+				case GDScriptParser::ClassNode::Member::SIGNAL:
+					if (p_base == nullptr) {
+						GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+						if (thread_safe_function != nullptr) {
+							push_error(vformat(R"*(Cannot use signal "%s" from the thread-safe function "%s()".)*", name, thread_safe_function->identifier->name), p_identifier);
+						}
+					}
 					break;
 				case GDScriptParser::ClassNode::Member::CLASS:
 					// For out-of-order resolution:
@@ -3054,6 +3111,13 @@ void GDScriptAnalyzer::reduce_identifier(GDScriptParser::IdentifierNode *p_ident
 			push_error(vformat(R"*(Cannot access instance variable "%s" from the static function "%s()".)*", p_identifier->name, parent_function->identifier->name), p_identifier);
 		}
 
+		if (p_identifier->source == GDScriptParser::IdentifierNode::MEMBER_VARIABLE || p_identifier->source == GDScriptParser::IdentifierNode::INHERITED_VARIABLE) {
+			GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+			if (thread_safe_function != nullptr) {
+				push_error(vformat(R"*(Cannot access instance variable "%s" from the thread-safe function "%s()".)*", p_identifier->name, thread_safe_function->identifier->name), p_identifier);
+			}
+		}
+
 		if (!lambda_stack.is_empty()) {
 			// If the identifier is a member variable (including the native class properties), we consider the lambda to be using `self`, so we keep a reference to the current instance.
 			if (p_identifier->source == GDScriptParser::IdentifierNode::MEMBER_VARIABLE || p_identifier->source == GDScriptParser::IdentifierNode::INHERITED_VARIABLE) {
@@ -3262,6 +3326,11 @@ void GDScriptAnalyzer::reduce_self(GDScriptParser::SelfNode *p_self) {
 	p_self->is_constant = false;
 	p_self->set_datatype(type_from_metatype(parser->current_class->get_datatype()));
 	mark_lambda_use_self();
+
+	GDScriptParser::FunctionNode *thread_safe_function = get_thread_safe_function();
+	if (thread_safe_function != nullptr) {
+		push_error(vformat(R"*(Cannot use "self" inside the thread-safe function "%s()".)*", thread_safe_function->identifier->name), p_self);
+	}
 }
 
 void GDScriptAnalyzer::reduce_subscript(GDScriptParser::SubscriptNode *p_subscript) {
@@ -4266,6 +4335,32 @@ void GDScriptAnalyzer::mark_lambda_use_self() {
 	}
 }
 
+GDScriptParser::FunctionNode *GDScriptAnalyzer::get_thread_safe_function() const {
+	// Lambdas are bound by the restrictions of the function they are declared in.
+	GDScriptParser::FunctionNode *function = parser->current_function;
+	while (function && function->source_lambda) {
+		function = function->source_lambda->parent_function;
+	}
+	if (function && function->is_thread_safe) {
+		return function;
+	}
+	return nullptr;
+}
+
+bool GDScriptAnalyzer::is_thread_safe_method(const GDScriptParser::DataType &p_base_type, const StringName &p_function) const {
+	GDScriptParser::DataType base_type = p_base_type;
+	while (base_type.kind == GDScriptParser::DataType::CLASS && base_type.class_type != nullptr) {
+		GDScriptParser::ClassNode *base_class = base_type.class_type;
+		if (base_class->has_member(p_function)) {
+			const GDScriptParser::ClassNode::Member &member = base_class->get_member(p_function);
+			return member.type == GDScriptParser::ClassNode::Member::FUNCTION && member.function->is_thread_safe;
+		}
+		base_type = base_class->base_type;
+	}
+	// Native methods may touch the instance or the scene tree.
+	return false;
+}
+
 bool GDScriptAnalyzer::class_exists(const StringName &p_class) const {
 	return ClassDB::class_exists(p_class) && ClassDB::is_class_exposed(p_class);
 }
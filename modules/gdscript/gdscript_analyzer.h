@@ -116,6 +116,8 @@ class GDScriptAnalyzer {
 	void push_error(const String &p_message, const GDScriptParser::Node *p_origin);
 	void mark_node_unsafe(const GDScriptParser::Node *p_node);
 	void mark_lambda_use_self();
+	GDScriptParser::FunctionNode *get_thread_safe_function() const;
+	bool is_thread_safe_method(const GDScriptParser::DataType &p_base_type, const StringName &p_function) const;
 	bool class_exists(const StringName &p_class) const;
 	Ref<GDScriptParserRef> get_parser_for(const String &p_path);
 #ifdef DEBUG_ENABLED
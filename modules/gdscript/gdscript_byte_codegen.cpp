@@ -33,6 +33,35 @@
 #include "core/debugger/engine_debugger.h"
 #include "gdscript.h"
 
+void GDScriptByteCodePool::finish() {
+	Vector<Variant> constants;
+	constants.resize(constant_map.size());
+	for (const KeyValue<Variant, int> &K : constant_map) {
+		constants.write[K.value] = K.key;
+	}
+
+	Vector<StringName> global_names;
+	global_names.resize(name_map.size());
+	for (const KeyValue<StringName, int> &E : name_map) {
+		global_names.write[E.value] = E.key;
+	}
+
+	// All functions reference the same buffers, which must not be written anymore.
+	for (GDScriptFunction *function : functions) {
+		function->constants = constants;
+		function->_constants_ptr = constants.is_empty() ? nullptr : const_cast<Variant *>(function->constants.ptr());
+		function->_constant_count = constants.size();
+
+		function->global_names = global_names;
+		function->_global_names_ptr = global_names.is_empty() ? nullptr : function->global_names.ptr();
+		function->_global_names_count = global_names.size();
+	}
+
+	constant_map.clear();
+	name_map.clear();
+	functions.clear();
+}
+
 uint32_t GDScriptByteCodeGenerator::add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) {
 #ifdef TOOLS_ENABLED
 	function->arg_names.push_back(p_name);
@@ -142,6 +171,20 @@ uint32_t GDScriptByteCodeGenerator::add_temporary(const GDScriptDataType &p_type
 void GDScriptByteCodeGenerator::pop_temporary() {
 	ERR_FAIL_COND(used_temporaries.is_empty());
 	int slot_idx = used_temporaries.back()->get();
+
+	if (fusable_assign_pos >= 0 && fusable_assign_pos + 3 == opcodes.size() && fusable_temporary == slot_idx) {
+		// The temporary dies right after being assigned, so the operator can write to the assignment target
+		// instead, and the assignment is dropped.
+		StackSlot &temp = temporaries.write[slot_idx];
+		int ref_count = temp.bytecode_indices.size();
+		if (ref_count >= 2 && temp.bytecode_indices[ref_count - 2] == fusable_operator_pos + 3 && temp.bytecode_indices[ref_count - 1] == fusable_assign_pos + 2) {
+			temp.bytecode_indices.resize(ref_count - 2);
+			opcodes.write[fusable_operator_pos + 3] = opcodes[fusable_assign_pos + 1];
+			opcodes.resize(fusable_assign_pos);
+		}
+		clear_fusable_operator();
+	}
+
 	const StackSlot &slot = temporaries[slot_idx];
 	temporaries_pool[slot.type].push_back(slot_idx);
 	used_temporaries.pop_back();
@@ -160,7 +203,9 @@ void GDScriptByteCodeGenerator::end_parameters() {
 
 void GDScriptByteCodeGenerator::write_start(GDScript *p_script, const StringName &p_function_name, bool p_static, Variant p_rpc_config, const GDScriptDataType &p_return_type) {
 	function = memnew(GDScriptFunction);
+#ifdef DEBUG_ENABLED
 	debug_stack = EngineDebugger::is_active();
+#endif
 
 	function->name = p_function_name;
 	function->_script = p_script;
@@ -195,30 +240,8 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		}
 	}
 
-	if (constant_map.size()) {
-		function->_constant_count = constant_map.size();
-		function->constants.resize(constant_map.size());
-		function->_constants_ptr = function->constants.ptrw();
-		for (const KeyValue<Variant, int> &K : constant_map) {
-			function->constants.write[K.value] = K.key;
-		}
-	} else {
-		function->_constants_ptr = nullptr;
-		function->_constant_count = 0;
-	}
-
-	if (name_map.size()) {
-		function->global_names.resize(name_map.size());
-		function->_global_names_ptr = &function->global_names[0];
-		for (const KeyValue<StringName, int> &E : name_map) {
-			function->global_names.write[E.value] = E.key;
-		}
-		function->_global_names_count = function->global_names.size();
-
-	} else {
-		function->_global_names_ptr = nullptr;
-		function->_global_names_count = 0;
-	}
+	// Constants and global names are set when the whole compilation unit is done.
+	pool->functions.push_back(function);
 
 	if (opcodes.size()) {
 		function->code = opcodes;
@@ -394,6 +417,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (member_cache_count) {
+		function->_member_caches_ptr = memnew_arr(SafeNumeric<uint64_t>, member_cache_count);
+		function->_member_caches_count = member_cache_count;
+	} else {
+		function->_member_caches_ptr = nullptr;
+		function->_member_caches_count = 0;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -541,7 +572,68 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 	append(p_target);
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_raw_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_INT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_INT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_INT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT;
+			default:
+				break;
+		}
+	}
+	return GDScriptFunction::OPCODE_END;
+}
+
+void GDScriptByteCodeGenerator::set_fusable_operator(const Address &p_target, int p_operator_pos, Variant::Type p_result_type) {
+	clear_fusable_operator();
+	if (p_target.mode == Address::TEMPORARY) {
+		fusable_operator_pos = p_operator_pos;
+		fusable_operator_end = opcodes.size();
+		fusable_temporary = p_target.address;
+		fusable_result_type = p_result_type;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand) {
+	int operator_pos = opcodes.size();
+
 	if (HAS_BUILTIN_TYPE(p_left_operand)) {
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
@@ -551,6 +643,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 		append(Address());
 		append(p_target);
 		append(op_func);
+		set_fusable_operator(p_target, operator_pos, Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, Variant::NIL));
 		return;
 	}
 
@@ -560,35 +653,56 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	append(Address());
 	append(p_target);
 	append(p_operator);
+	set_fusable_operator(p_target, operator_pos, Variant::NIL);
 }
 
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand)) {
+		Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		bool type_adjusted = false;
 		if (p_target.mode == Address::TEMPORARY) {
-			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
+				type_adjusted = true;
 			}
 		}
 
-		// Gather specific operator.
-		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		int operator_pos = opcodes.size();
+		GDScriptFunction::Opcode raw_opcode = get_raw_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (raw_opcode != GDScriptFunction::OPCODE_END) {
+			// Operate on the values directly, without calling the operator function.
+			append(raw_opcode, 3);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+		} else {
+			// Gather specific operator.
+			Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
-		append(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, 3);
-		append(p_left_operand);
-		append(p_right_operand);
-		append(p_target);
-		append(op_func);
+			append(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, 3);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(op_func);
+		}
+		if (type_adjusted) {
+			// The temporary is still needed to hold the adjusted type.
+			clear_fusable_operator();
+		} else {
+			set_fusable_operator(p_target, operator_pos, result_type);
+		}
 		return;
 	}
 
 	// No specific types, perform variant evaluation.
+	int operator_pos = opcodes.size();
 	append(GDScriptFunction::OPCODE_OPERATOR, 3);
 	append(p_left_operand);
 	append(p_right_operand);
 	append(p_target);
 	append(p_operator);
+	set_fusable_operator(p_target, operator_pos, Variant::NIL);
 }
 
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const Address &p_type) {
@@ -771,6 +885,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append(member_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -786,6 +901,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(member_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -856,9 +972,37 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_source);
 		append(p_target.type.builtin_type);
 	} else {
+		bool fusable = false;
+		if (fusable_operator_pos >= 0 && fusable_operator_end == opcodes.size() && p_source.mode == Address::TEMPORARY && int(p_source.address) == fusable_temporary) {
+			// Only the generic operator changes the type of its result.
+			bool validated = (opcodes[fusable_operator_pos] & GDScriptFunction::INSTR_MASK) != GDScriptFunction::OPCODE_OPERATOR;
+			switch (p_target.mode) {
+				case Address::LOCAL_VARIABLE: {
+					// Validated operators don't change the type of the result, so the variable must already hold it.
+					// The first reference to a local is its declaration, which sets the type.
+					int local_idx = int(p_target.address) - RESERVED_STACK;
+					fusable = !validated || (IS_BUILTIN_TYPE(p_target, fusable_result_type) && local_idx >= 0 && local_idx < locals.size() && locals[local_idx].referenced);
+				} break;
+				case Address::FUNCTION_PARAMETER:
+				case Address::MEMBER: {
+					fusable = !validated;
+				} break;
+				default:
+					break;
+			}
+		}
+
+		int assign_pos = opcodes.size();
 		append(GDScriptFunction::OPCODE_ASSIGN, 2);
 		append(p_target);
 		append(p_source);
+
+		// Don't write into a variable which is also an operand, the operator may still be reading it.
+		if (fusable && opcodes[assign_pos + 1] != opcodes[fusable_operator_pos + 1] && opcodes[assign_pos + 1] != opcodes[fusable_operator_pos + 2]) {
+			fusable_assign_pos = assign_pos;
+		} else {
+			clear_fusable_operator();
+		}
 	}
 }
 
@@ -874,6 +1018,7 @@ void GDScriptByteCodeGenerator::write_assign_false(const Address &p_target) {
 
 void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_dst, const Address &p_src) {
 	write_assign(p_dst, p_src);
+	clear_fusable_operator(); // The end of the assignment is a jump target.
 	function->default_arguments.push_back(opcodes.size());
 }
 
@@ -1520,6 +1665,7 @@ void GDScriptByteCodeGenerator::write_endfor() {
 }
 
 void GDScriptByteCodeGenerator::start_while_condition() {
+	clear_fusable_operator();
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
 }
@@ -1593,8 +1739,11 @@ void GDScriptByteCodeGenerator::write_breakpoint() {
 }
 
 void GDScriptByteCodeGenerator::write_newline(int p_line) {
+#ifdef DEBUG_ENABLED
+	// Lines are only used by the debugger and error reports, which release builds don't have.
 	append(GDScriptFunction::OPCODE_LINE, 0);
 	append(p_line);
+#endif
 	current_line = p_line;
 }
 
@@ -36,10 +36,24 @@
 #include "gdscript_function.h"
 #include "gdscript_utility_functions.h"
 
+// Constants and global names of all the functions compiled together (a script and its inner
+// classes). Every function indexes the same tables, so each value is only stored once.
+class GDScriptByteCodePool {
+	friend class GDScriptByteCodeGenerator;
+
+	HashMap<Variant, int, VariantHasher, VariantComparator> constant_map;
+	RBMap<StringName, int> name_map;
+	Vector<GDScriptFunction *> functions;
+
+public:
+	void finish();
+};
+
 class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	struct StackSlot {
 		Variant::Type type = Variant::NIL;
 		Vector<int> bytecode_indices;
+		bool referenced = false; // Locals only. Once referenced, the declaration already gave them their type.
 
 		StackSlot() = default;
 		StackSlot(Variant::Type p_type) :
@@ -50,6 +64,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	bool ended = false;
 	GDScriptFunction *function = nullptr;
+	GDScriptByteCodePool *pool = nullptr;
 	bool debug_stack = false;
 
 	Vector<int> opcodes;
@@ -71,13 +86,12 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 	int ptrcall_max = 0;
+	int member_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
 
-	HashMap<Variant, int, VariantHasher, VariantComparator> constant_map;
-	RBMap<StringName, int> name_map;
 #ifdef TOOLS_ENABLED
 	Vector<StringName> named_globals;
 #endif
@@ -115,6 +129,21 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	List<List<int>> current_breaks_to_patch;
 	List<List<int>> match_continues_to_patch;
 
+	// Peephole state to write an operator result straight into the variable it is assigned to,
+	// instead of going through a temporary.
+	int fusable_operator_pos = -1;
+	int fusable_operator_end = -1;
+	int fusable_assign_pos = -1;
+	int fusable_temporary = -1;
+	Variant::Type fusable_result_type = Variant::NIL;
+
+	void clear_fusable_operator() {
+		fusable_operator_pos = -1;
+		fusable_operator_end = -1;
+		fusable_assign_pos = -1;
+		fusable_temporary = -1;
+	}
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -168,21 +197,21 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	int get_name_map_pos(const StringName &p_identifier) {
 		int ret;
-		if (!name_map.has(p_identifier)) {
-			ret = name_map.size();
-			name_map[p_identifier] = ret;
+		if (!pool->name_map.has(p_identifier)) {
+			ret = pool->name_map.size();
+			pool->name_map[p_identifier] = ret;
 		} else {
-			ret = name_map[p_identifier];
+			ret = pool->name_map[p_identifier];
 		}
 		return ret;
 	}
 
 	int get_constant_pos(const Variant &p_constant) {
-		if (constant_map.has(p_constant)) {
-			return constant_map[p_constant];
+		if (pool->constant_map.has(p_constant)) {
+			return pool->constant_map[p_constant];
 		}
-		int pos = constant_map.size();
-		constant_map[p_constant] = pos;
+		int pos = pool->constant_map.size();
+		pool->constant_map[p_constant] = pos;
 		return pos;
 	}
 
@@ -320,8 +349,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 			case Address::CONSTANT:
 				return p_address.address | (GDScriptFunction::ADDR_TYPE_CONSTANT << GDScriptFunction::ADDR_BITS);
 			case Address::LOCAL_VARIABLE:
-			case Address::FUNCTION_PARAMETER:
+			case Address::FUNCTION_PARAMETER: {
+				int local_idx = int(p_address.address) - RESERVED_STACK;
+				if (local_idx >= 0 && local_idx < locals.size()) {
+					locals.write[local_idx].referenced = true;
+				}
 				return p_address.address | (GDScriptFunction::ADDR_TYPE_STACK << GDScriptFunction::ADDR_BITS);
+			}
 			case Address::TEMPORARY:
 				temporaries.write[p_address.address].bytecode_indices.push_back(opcodes.size());
 				return -1;
@@ -401,9 +435,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	void patch_jump(int p_address) {
+		// Jumps may land here, so the code before can no longer be removed.
+		clear_fusable_operator();
 		opcodes.write[p_address] = opcodes.size();
 	}
 
+	static GDScriptFunction::Opcode get_raw_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type);
+	void set_fusable_operator(const Address &p_target, int p_operator_pos, Variant::Type p_result_type);
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -499,6 +538,8 @@ public:
 	virtual void write_return(const Address &p_return_value) override;
 	virtual void write_assert(const Address &p_test, const Address &p_message) override;
 
+	GDScriptByteCodeGenerator(GDScriptByteCodePool *p_pool) :
+			pool(p_pool) {}
 	virtual ~GDScriptByteCodeGenerator();
 };
 
@@ -31,6 +31,7 @@
 #include "gdscript_cache.h"
 
 #include "core/io/file_access.h"
+#include "core/io/resource_loader.h"
 #include "core/templates/vector.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
@@ -57,10 +58,15 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 
 	while (p_new_status > status) {
 		switch (status) {
-			case EMPTY:
+			case EMPTY: {
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
-				break;
+				String remapped_path = ResourceLoader::path_remap(path);
+				if (remapped_path.get_extension().to_lower() == "gdc") {
+					result = parser->parse_binary(GDScriptCache::get_binary_tokens(remapped_path), path);
+				} else {
+					result = parser->parse(GDScriptCache::get_source_code(path), path, false);
+				}
+			} break;
 			case PARSED: {
 				analyzer = memnew(GDScriptAnalyzer(parser));
 				status = INHERITANCE_SOLVED;
@@ -127,7 +133,7 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 			return ref;
 		}
 	} else {
-		if (!FileAccess::exists(p_path)) {
+		if (!FileAccess::exists(ResourceLoader::path_remap(p_path))) {
 			r_error = ERR_FILE_NOT_FOUND;
 			return ref;
 		}
@@ -161,6 +167,22 @@ String GDScriptCache::get_source_code(const String &p_path) {
 	return source;
 }
 
+Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
+	Error err;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_array(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, buffer, "Failed to open binary GDScript file '" + p_path + "'.");
+	return buffer;
+}
+
+static Error _load_script_code(GDScript *p_script, const String &p_path) {
+	// Exported projects remap scripts to their binary token stream.
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		return p_script->load_binary_tokens(remapped_path);
+	}
+	return p_script->load_source_code(p_path);
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, const String &p_owner) {
 	MutexLock lock(singleton->lock);
 	if (!p_owner.is_empty()) {
@@ -177,7 +199,7 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, const Stri
 	script.instantiate();
 	script->set_path(p_path, true);
 	script->set_script_path(p_path);
-	script->load_source_code(p_path);
+	_load_script_code(script.ptr(), p_path);
 
 	singleton->shallow_gdscript_cache[p_path] = script.ptr();
 	return script;
@@ -204,7 +226,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 		ERR_FAIL_COND_V(script.is_null(), Ref<GDScript>());
 	}
 
-	r_error = script->load_source_code(p_path);
+	r_error = _load_script_code(script.ptr(), p_path);
 
 	if (r_error) {
 		return script;
@@ -1258,6 +1258,76 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 	}
 }
 
+GDScriptCodeGenerator::Address GDScriptCompiler::_parse_range_bounds(CodeGen &codegen, Error &r_error, const GDScriptParser::CallNode *p_range) {
+	// Builds the int, Vector2i or Vector3i that the range iteration opcodes expect, like
+	// the analyzer does for constant arguments, so "range()" never allocates an array.
+	GDScriptParser::DataType first_type = p_range->arguments[0]->get_datatype();
+	if (p_range->arguments.size() == 1 && first_type.is_hard_type() && first_type.kind == GDScriptParser::DataType::BUILTIN && first_type.builtin_type == Variant::INT) {
+		// Already an int, no need to convert.
+		return _parse_expression(codegen, r_error, p_range->arguments[0]);
+	}
+
+	GDScriptDataType bounds_type = _gdtype_from_datatype(p_range->get_datatype());
+	GDScriptCodeGenerator::Address bounds = codegen.add_temporary(bounds_type);
+
+	Vector<GDScriptCodeGenerator::Address> arguments;
+	for (int i = 0; i < p_range->arguments.size(); i++) {
+		GDScriptCodeGenerator::Address arg = _parse_expression(codegen, r_error, p_range->arguments[i]);
+		if (r_error) {
+			return GDScriptCodeGenerator::Address();
+		}
+		arguments.push_back(arg);
+	}
+
+	if (arguments.size() == 1) {
+		codegen.generator->write_construct(bounds, Variant::INT, arguments);
+	} else {
+		// Vector2i and Vector3i only hold 32-bit bounds, and a zero step has to raise the
+		// "range()" error, so fall back to calling "range()" when the bounds don't fit.
+		GDScriptDataType bool_type;
+		bool_type.has_type = true;
+		bool_type.kind = GDScriptDataType::BUILTIN;
+		bool_type.builtin_type = Variant::BOOL;
+
+		GDScriptCodeGenerator::Address fits = codegen.add_temporary(bool_type);
+		GDScriptCodeGenerator::Address check = codegen.add_temporary(bool_type);
+		GDScriptCodeGenerator::Address min = codegen.add_constant((int64_t)INT32_MIN);
+		GDScriptCodeGenerator::Address max = codegen.add_constant((int64_t)INT32_MAX);
+
+		for (int i = 0; i < arguments.size(); i++) {
+			if (i == 0) {
+				codegen.generator->write_binary_operator(fits, Variant::OP_GREATER_EQUAL, arguments[i], min);
+			} else {
+				codegen.generator->write_binary_operator(check, Variant::OP_GREATER_EQUAL, arguments[i], min);
+				codegen.generator->write_binary_operator(fits, Variant::OP_AND, fits, check);
+			}
+			codegen.generator->write_binary_operator(check, Variant::OP_LESS_EQUAL, arguments[i], max);
+			codegen.generator->write_binary_operator(fits, Variant::OP_AND, fits, check);
+		}
+		if (arguments.size() == 3) {
+			codegen.generator->write_binary_operator(check, Variant::OP_NOT_EQUAL, arguments[2], codegen.add_constant((int64_t)0));
+			codegen.generator->write_binary_operator(fits, Variant::OP_AND, fits, check);
+		}
+
+		codegen.generator->write_if(fits);
+		codegen.generator->write_construct(bounds, arguments.size() == 2 ? Variant::VECTOR2I : Variant::VECTOR3I, arguments);
+		codegen.generator->write_else();
+		codegen.generator->write_call_gdscript_utility(bounds, GDScriptUtilityFunctions::get_function("range"), arguments);
+		codegen.generator->write_endif();
+
+		codegen.generator->pop_temporary();
+		codegen.generator->pop_temporary();
+	}
+
+	for (int i = 0; i < arguments.size(); i++) {
+		if (arguments[i].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+			codegen.generator->pop_temporary();
+		}
+	}
+
+	return bounds;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_match_pattern(CodeGen &codegen, Error &r_error, const GDScriptParser::PatternNode *p_pattern, const GDScriptCodeGenerator::Address &p_value_addr, const GDScriptCodeGenerator::Address &p_type_addr, const GDScriptCodeGenerator::Address &p_previous_test, bool p_is_first, bool p_is_nested) {
 	switch (p_pattern->pattern_type) {
 		case GDScriptParser::PatternNode::PT_LITERAL: {
@@ -1788,7 +1858,13 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype()));
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
+				GDScriptCodeGenerator::Address list;
+				if (for_n->list->type == GDScriptParser::Node::CALL && !for_n->list->is_constant && for_n->list->get_datatype().builtin_type != Variant::ARRAY && static_cast<const GDScriptParser::CallNode *>(for_n->list)->get_callee_type() == GDScriptParser::Node::IDENTIFIER && static_cast<const GDScriptParser::CallNode *>(for_n->list)->function_name == "range") {
+					// Counted loop, the analyzer resolved the list as a "range()" call.
+					list = _parse_range_bounds(codegen, err, static_cast<const GDScriptParser::CallNode *>(for_n->list));
+				} else {
+					list = _parse_expression(codegen, err, for_n->list);
+				}
 				if (err) {
 					return err;
 				}
@@ -1967,7 +2043,7 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::FunctionNode *p_func, bool p_for_ready, bool p_for_lambda) {
 	r_error = OK;
 	CodeGen codegen;
-	codegen.generator = memnew(GDScriptByteCodeGenerator);
+	codegen.generator = memnew(GDScriptByteCodeGenerator(&pool));
 
 	codegen.class_node = p_class;
 	codegen.script = p_script;
@@ -2165,6 +2241,7 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 			gd_function->return_type.kind = GDScriptDataType::BUILTIN;
 			gd_function->return_type.builtin_type = Variant::NIL;
 		}
+		gd_function->_thread_safe = p_func->is_thread_safe;
 #ifdef TOOLS_ENABLED
 		gd_function->default_arg_values = p_func->default_arg_values;
 #endif
@@ -2246,6 +2323,7 @@ Error GDScriptCompiler::_parse_class_level(GDScript *p_script, const GDScriptPar
 	}
 	p_script->member_functions.clear();
 	p_script->member_indices.clear();
+	p_script->member_cache_id = GDScript::last_member_cache_id.increment();
 	p_script->member_info.clear();
 	p_script->_signals.clear();
 	p_script->initializer = nullptr;
@@ -2682,11 +2760,12 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	p_script->_owner = nullptr;
 	Error err = _parse_class_level(p_script, root, p_keep_state);
 
-	if (err) {
-		return err;
+	if (!err) {
+		err = _parse_class_blocks(p_script, root, p_keep_state);
 	}
 
-	err = _parse_class_blocks(p_script, root, p_keep_state);
+	// Give the shared constants and names to every function compiled so far, even on failure.
+	pool.finish();
 
 	if (err) {
 		return err;
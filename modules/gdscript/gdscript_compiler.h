@@ -33,6 +33,7 @@
 
 #include "core/templates/hash_set.h"
 #include "gdscript.h"
+#include "gdscript_byte_codegen.h"
 #include "gdscript_codegen.h"
 #include "gdscript_function.h"
 #include "gdscript_parser.h"
@@ -42,6 +43,7 @@ class GDScriptCompiler {
 	HashSet<GDScript *> parsed_classes;
 	HashSet<GDScript *> parsing_classes;
 	GDScript *main_script = nullptr;
+	GDScriptByteCodePool pool;
 
 	struct CodeGen {
 		GDScript *script = nullptr;
@@ -125,6 +127,7 @@ class GDScriptCompiler {
 
 	GDScriptCodeGenerator::Address _parse_assign_right_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::AssignmentNode *p_assignmentint, const GDScriptCodeGenerator::Address &p_index_addr = GDScriptCodeGenerator::Address());
 	GDScriptCodeGenerator::Address _parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root = false, bool p_initializer = false, const GDScriptCodeGenerator::Address &p_index_addr = GDScriptCodeGenerator::Address());
+	GDScriptCodeGenerator::Address _parse_range_bounds(CodeGen &codegen, Error &r_error, const GDScriptParser::CallNode *p_range);
 	GDScriptCodeGenerator::Address _parse_match_pattern(CodeGen &codegen, Error &r_error, const GDScriptParser::PatternNode *p_pattern, const GDScriptCodeGenerator::Address &p_value_addr, const GDScriptCodeGenerator::Address &p_type_addr, const GDScriptCodeGenerator::Address &p_previous_test, bool p_is_first, bool p_is_nested);
 	void _add_locals_in_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block);
 	Error _parse_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block, bool p_add_locals = true);
@@ -134,6 +134,38 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_RAW(m_name, m_op) \
+	case OPCODE_OPERATOR_##m_name: {           \
+		text += "operator (";                  \
+		text += #m_name;                       \
+		text += ") ";                          \
+		text += DADDR(3);                      \
+		text += " = ";                         \
+		text += DADDR(1);                      \
+		text += " " m_op " ";                  \
+		text += DADDR(2);                      \
+		incr += 4;                             \
+	} break
+
+				DISASSEMBLE_OPERATOR_RAW(ADD_INT, "+");
+				DISASSEMBLE_OPERATOR_RAW(SUBTRACT_INT, "-");
+				DISASSEMBLE_OPERATOR_RAW(MULTIPLY_INT, "*");
+				DISASSEMBLE_OPERATOR_RAW(EQUAL_INT, "==");
+				DISASSEMBLE_OPERATOR_RAW(NOT_EQUAL_INT, "!=");
+				DISASSEMBLE_OPERATOR_RAW(LESS_INT, "<");
+				DISASSEMBLE_OPERATOR_RAW(LESS_EQUAL_INT, "<=");
+				DISASSEMBLE_OPERATOR_RAW(GREATER_INT, ">");
+				DISASSEMBLE_OPERATOR_RAW(GREATER_EQUAL_INT, ">=");
+				DISASSEMBLE_OPERATOR_RAW(ADD_FLOAT, "+");
+				DISASSEMBLE_OPERATOR_RAW(SUBTRACT_FLOAT, "-");
+				DISASSEMBLE_OPERATOR_RAW(MULTIPLY_FLOAT, "*");
+				DISASSEMBLE_OPERATOR_RAW(DIVIDE_FLOAT, "/");
+				DISASSEMBLE_OPERATOR_RAW(LESS_FLOAT, "<");
+				DISASSEMBLE_OPERATOR_RAW(LESS_EQUAL_FLOAT, "<=");
+				DISASSEMBLE_OPERATOR_RAW(GREATER_FLOAT, ">");
+				DISASSEMBLE_OPERATOR_RAW(GREATER_EQUAL_FLOAT, ">=");
+
 			case OPCODE_EXTENDS_TEST: {
 				text += "is object ";
 				text += DADDR(3);
@@ -225,7 +257,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -246,7 +278,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
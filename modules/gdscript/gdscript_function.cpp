@@ -138,6 +138,10 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+#ifdef DEBUG_ENABLED
+thread_local int GDScriptFunction::_thread_safe_depth = 0;
+#endif
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -153,6 +157,10 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	if (_member_caches_ptr) {
+		memdelete_arr(_member_caches_ptr);
+	}
+
 #ifdef DEBUG_ENABLED
 
 	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
@@ -308,4 +316,6 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
 	}
+	// The stack was moved here on await, so release it if the function was never resumed.
+	_clear_stack();
 }
@@ -36,6 +36,7 @@
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 #include "gdscript_utility_functions.h"
@@ -219,6 +220,23 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
 		OPCODE_EXTENDS_TEST,
 		OPCODE_IS_BUILTIN,
 		OPCODE_SET_KEYED,
@@ -432,6 +450,7 @@ public:
 private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
+	friend class GDScriptByteCodePool;
 
 	StringName source;
 
@@ -468,6 +487,8 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	int _lambdas_count = 0;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	int _member_caches_count = 0;
+	SafeNumeric<uint64_t> *_member_caches_ptr = nullptr;
 	const int *_code_ptr = nullptr;
 	int _code_size = 0;
 	int _argument_count = 0;
@@ -477,6 +498,7 @@ private:
 
 	int _initial_line = 0;
 	bool _static = false;
+	bool _thread_safe = false;
 	Variant rpc_config;
 
 	GDScript *_script = nullptr;
@@ -514,6 +536,12 @@ private:
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
 	_FORCE_INLINE_ Variant *_get_variant(int p_address, GDScriptInstance *p_instance, Variant *p_stack, String &r_error) const;
+
+	// Inline caches for named member access, used when the base is an untyped GDScript instance.
+	// Each entry holds the script's member cache ID in the upper 32 bits and the member index in the lower ones.
+	_FORCE_INLINE_ static GDScriptInstance *_get_member_cache_instance(const Variant *p_base);
+	_FORCE_INLINE_ static uint32_t _get_cached_member_index(const SafeNumeric<uint64_t> &p_cache, const GDScriptInstance *p_instance);
+	static void _update_member_cache(SafeNumeric<uint64_t> &p_cache, const GDScriptInstance *p_instance, const StringName &p_name, bool p_get);
 	_FORCE_INLINE_ String _get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const;
 
 	friend class GDScriptLanguage;
@@ -536,6 +564,12 @@ private:
 		uint64_t last_frame_total_time = 0;
 	} profile;
 
+	friend class GDScriptSamplingProfiler;
+	uint32_t sampling_id = 0;
+
+	// Number of `@thread_safe` functions running on the calling thread.
+	static thread_local int _thread_safe_depth;
+
 #endif
 
 public:
@@ -556,6 +590,10 @@ public:
 	};
 
 	_FORCE_INLINE_ bool is_static() const { return _static; }
+	_FORCE_INLINE_ bool is_thread_safe() const { return _thread_safe; }
+#ifdef DEBUG_ENABLED
+	_FORCE_INLINE_ static bool is_in_thread_safe_call() { return _thread_safe_depth > 0; }
+#endif
 
 	const int *get_code() const; //used for debug
 	int get_code_size() const;
@@ -147,6 +147,8 @@ GDScriptParser::GDScriptParser() {
 	register_annotation(MethodInfo("@warning_ignore", PropertyInfo(Variant::STRING, "warning")), AnnotationInfo::CLASS | AnnotationInfo::VARIABLE | AnnotationInfo::SIGNAL | AnnotationInfo::CONSTANT | AnnotationInfo::FUNCTION | AnnotationInfo::STATEMENT, &GDScriptParser::warning_annotations, varray(), true);
 	// Networking.
 	register_annotation(MethodInfo("@rpc", PropertyInfo(Variant::STRING, "mode"), PropertyInfo(Variant::STRING, "sync"), PropertyInfo(Variant::STRING, "transfer_mode"), PropertyInfo(Variant::INT, "transfer_channel")), AnnotationInfo::FUNCTION, &GDScriptParser::rpc_annotation, varray("", "", "", 0), true);
+	// Threading.
+	register_annotation(MethodInfo("@thread_safe"), AnnotationInfo::FUNCTION, &GDScriptParser::thread_safe_annotation);
 }
 
 GDScriptParser::~GDScriptParser() {
@@ -359,6 +361,24 @@ Error GDScriptParser::parse(const String &p_source_code, const String &p_script_
 	tokenizer.set_source_code(source);
 	tokenizer.set_cursor_position(cursor_line, cursor_column);
 	script_path = p_script_path;
+
+	return parse_tokens();
+}
+
+Error GDScriptParser::parse_binary(const Vector<uint8_t> &p_binary, const String &p_script_path) {
+	clear();
+
+	for_completion = false;
+	script_path = p_script_path;
+	if (tokenizer.set_code_buffer(p_binary) != OK) {
+		push_error("Invalid binary token stream.");
+		return ERR_PARSE_ERROR;
+	}
+
+	return parse_tokens();
+}
+
+Error GDScriptParser::parse_tokens() {
 	current = tokenizer.scan();
 	// Avoid error or newline as the first token.
 	// The latter can mess with the parser when opening files filled exclusively with comments and newlines.
@@ -3941,6 +3961,18 @@ bool GDScriptParser::rpc_annotation(const AnnotationNode *p_annotation, Node *p_
 	return true;
 }
 
+bool GDScriptParser::thread_safe_annotation(const AnnotationNode *p_annotation, Node *p_node) {
+	ERR_FAIL_COND_V_MSG(p_node->type != Node::FUNCTION, false, R"("@thread_safe" annotation can only be applied to functions.)");
+
+	FunctionNode *function = static_cast<FunctionNode *>(p_node);
+	if (function->is_thread_safe) {
+		push_error(R"("@thread_safe" annotation can only be used once per function.)", p_annotation);
+		return false;
+	}
+	function->is_thread_safe = true;
+	return true;
+}
+
 GDScriptParser::DataType GDScriptParser::SuiteNode::Local::get_datatype() const {
 	switch (type) {
 		case CONSTANT:
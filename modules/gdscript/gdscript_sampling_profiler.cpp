@@ -0,0 +1,256 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/sort_array.h"
+#include "gdscript_function.h"
+
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::running = nullptr;
+LocalVector<GDScriptSamplingProfiler::FunctionInfo> GDScriptSamplingProfiler::functions;
+GDScriptSamplingProfiler::Frame GDScriptSamplingProfiler::frames[MAX_STACK_DEPTH];
+SafeNumeric<uint32_t> GDScriptSamplingProfiler::depth;
+SafeNumeric<int> GDScriptSamplingProfiler::overflow_line;
+uint32_t GDScriptSamplingProfiler::generation = 0;
+
+SafeNumeric<int> *GDScriptSamplingProfiler::enter_function(GDScriptFunction *p_function, int p_line, uint32_t &r_generation) {
+	if (Thread::get_caller_id() != Thread::get_main_id()) {
+		return nullptr; // Only the main thread is sampled.
+	}
+
+	if (unlikely(p_function->sampling_id == 0)) {
+		if (functions.is_empty()) {
+			functions.push_back(FunctionInfo()); // Zero is reserved for functions not seen yet.
+		}
+		FunctionInfo info;
+		info.name = p_function->get_name();
+		info.source = p_function->get_source();
+		p_function->sampling_id = functions.size();
+		functions.push_back(info);
+	}
+
+	uint32_t current = depth.get();
+	SafeNumeric<int> *line = &overflow_line;
+	if (current < MAX_STACK_DEPTH) {
+		frames[current].function_id.set(p_function->sampling_id);
+		frames[current].line.set(p_line);
+		line = &frames[current].line;
+	}
+	// Publish the frame after writing it, so the sampling thread never reads it half written.
+	depth.set(current + 1);
+	r_generation = generation;
+	return line;
+}
+
+void GDScriptSamplingProfiler::exit_function(uint32_t p_generation) {
+	if (!is_sampling(p_generation)) {
+		return; // Entered during a run that has been stopped since.
+	}
+	uint32_t current = depth.get();
+	if (current > 0) {
+		depth.set(current - 1);
+	}
+}
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_userdata);
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		profiler->_take_sample();
+	}
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	uint32_t current = MIN(depth.get(), (uint32_t)MAX_STACK_DEPTH);
+	if (current == 0) {
+		idle_count++;
+		return;
+	}
+
+	// The main thread keeps running while the stack is read, so a sample may mix frames from consecutive
+	// calls. Frames belong to the profiler, so reading one that was just popped is harmless.
+	String key;
+	for (uint32_t i = 0; i < current; i++) {
+		if (!key.is_empty()) {
+			key += ";";
+		}
+		key += itos(frames[i].function_id.get()) + ":" + itos(frames[i].line.get());
+	}
+
+	HashMap<String, uint64_t>::Iterator E = stack_samples.find(key);
+	if (E) {
+		E->value++;
+	} else {
+		stack_samples.insert(key, 1);
+	}
+	sample_count++;
+}
+
+struct GDScriptSampledLine {
+	String label;
+	uint64_t self = 0;
+	uint64_t total = 0;
+};
+
+struct GDScriptSampledLineSort {
+	bool operator()(const GDScriptSampledLine &p_a, const GDScriptSampledLine &p_b) const {
+		return p_a.self != p_b.self ? p_a.self > p_b.self : p_a.total > p_b.total;
+	}
+};
+
+void GDScriptSamplingProfiler::_report() {
+	String folded;
+	HashMap<String, uint32_t> line_indices;
+	LocalVector<GDScriptSampledLine> lines;
+
+	for (const KeyValue<String, uint64_t> &E : stack_samples) {
+		Vector<String> stack = E.key.split(";");
+		HashSet<uint32_t> counted; // Recursive calls count once for the total of a line.
+		String folded_stack;
+
+		for (int i = 0; i < stack.size(); i++) {
+			uint32_t function_id = stack[i].get_slice(":", 0).to_int();
+			int line = stack[i].get_slice(":", 1).to_int();
+			String label;
+			if (function_id > 0 && function_id < functions.size()) {
+				const FunctionInfo &info = functions[function_id];
+				label = vformat("%s (%s:%d)", info.name, info.source, line);
+			} else {
+				label = vformat("<unknown> (line %d)", line);
+			}
+
+			if (!folded_stack.is_empty()) {
+				folded_stack += ";";
+			}
+			folded_stack += label;
+
+			uint32_t index;
+			HashMap<String, uint32_t>::Iterator L = line_indices.find(label);
+			if (L) {
+				index = L->value;
+			} else {
+				index = lines.size();
+				line_indices.insert(label, index);
+				GDScriptSampledLine sampled_line;
+				sampled_line.label = label;
+				lines.push_back(sampled_line);
+			}
+			if (!counted.has(index)) {
+				counted.insert(index);
+				lines[index].total += E.value;
+			}
+			if (i == stack.size() - 1) {
+				lines[index].self += E.value;
+			}
+		}
+
+		folded += folded_stack + " " + itos(E.value) + "\n";
+	}
+
+	uint64_t total_samples = sample_count + idle_count;
+	print_line(vformat("GDScript sampling profiler: %d samples in scripts, %d outside of scripts, every %d usec.", sample_count, idle_count, interval_usec));
+
+	if (!lines.is_empty()) {
+		SortArray<GDScriptSampledLine, GDScriptSampledLineSort> sorter;
+		sorter.sort(lines.ptr(), lines.size());
+
+		print_line("  self %   total %  line");
+		for (uint32_t i = 0; i < MIN(lines.size(), (uint32_t)HOTSPOT_PRINT_COUNT); i++) {
+			const GDScriptSampledLine &line = lines[i];
+			print_line(vformat("%8.2f  %8.2f  %s", line.self * 100.0 / total_samples, line.total * 100.0 / total_samples, line.label));
+		}
+	}
+
+	if (!output_file.is_empty()) {
+		Error err;
+		Ref<FileAccess> f = FileAccess::open(output_file, FileAccess::WRITE, &err);
+		ERR_FAIL_COND_MSG(err != OK, "Can't write GDScript sampling profile to '" + output_file + "'.");
+		f->store_string(folded);
+		print_line("GDScript sampling profile saved to '" + output_file + "'.");
+	}
+}
+
+void GDScriptSamplingProfiler::start(const String &p_output_file, uint64_t p_interval_usec) {
+	ERR_FAIL_COND_MSG(running != nullptr, "GDScript sampling profiler is already running.");
+	ERR_FAIL_COND_MSG(Thread::get_caller_id() != Thread::get_main_id(), "GDScript sampling profiler must be started from the main thread.");
+
+	// Calls still running from a previous run don't pop their frames, so start from an empty stack.
+	generation++;
+	depth.set(0);
+
+	GDScriptSamplingProfiler *profiler = memnew(GDScriptSamplingProfiler);
+	profiler->output_file = p_output_file;
+	profiler->interval_usec = MAX(p_interval_usec, (uint64_t)1);
+	profiler->thread.start(_thread_func, profiler);
+	running = profiler;
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (running == nullptr) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(Thread::get_caller_id() != Thread::get_main_id(), "GDScript sampling profiler must be stopped from the main thread.");
+
+	GDScriptSamplingProfiler *profiler = running;
+	running = nullptr;
+	profiler->exit_thread.set();
+	profiler->thread.wait_to_finish();
+	profiler->_report();
+	memdelete(profiler);
+}
+
+void GDScriptSamplingProfiler::_profiler_toggle(void *p_user, bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		// Options: output file for folded stacks, sampling interval in microseconds.
+		String file = p_opts.size() > 0 ? String(p_opts[0]) : String();
+		uint64_t interval = p_opts.size() > 1 ? uint64_t(p_opts[1]) : uint64_t(DEFAULT_INTERVAL_USEC);
+		start(file, interval);
+	} else {
+		stop();
+	}
+}
+
+void GDScriptSamplingProfiler::register_profiler() {
+	EngineDebugger::Profiler profiler(nullptr, _profiler_toggle, nullptr, nullptr);
+	EngineDebugger::register_profiler("gdscript_sampling", profiler);
+}
+
+void GDScriptSamplingProfiler::unregister_profiler() {
+	EngineDebugger::unregister_profiler("gdscript_sampling");
+	stop(); // In case it was started from the project settings.
+}
+
+#endif // DEBUG_ENABLED
@@ -0,0 +1,117 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Statistical profiler. While running, the VM publishes the functions of the main thread call stack
+// and their current line into frames owned by the profiler, and a background thread samples that stack
+// at a fixed interval.
+// Unlike the "scripts" profiler, no timing is done on function calls, and samples give per-line data.
+// Results are printed as per-line hotspots, and optionally saved as call stacks in the "folded" format
+// used by flame graph tools.
+class GDScriptSamplingProfiler {
+public:
+	enum {
+		MAX_STACK_DEPTH = 256,
+		DEFAULT_INTERVAL_USEC = 1000,
+		HOTSPOT_PRINT_COUNT = 30,
+	};
+
+private:
+	// Written by the main thread while the sampling thread reads them, hence atomic.
+	struct Frame {
+		SafeNumeric<uint32_t> function_id;
+		SafeNumeric<int> line;
+	};
+
+	struct FunctionInfo {
+		String name;
+		String source;
+	};
+
+	static GDScriptSamplingProfiler *running;
+	// Indexed by `GDScriptFunction::sampling_id`, filled on the main thread when a function is first sampled.
+	static LocalVector<FunctionInfo> functions;
+
+	// The stack isn't owned by a profiler run, since calls that entered it stay on the VM stack after
+	// the profiler is stopped, possibly by one of them.
+	static Frame frames[MAX_STACK_DEPTH];
+	static SafeNumeric<uint32_t> depth;
+	static SafeNumeric<int> overflow_line; // Given to calls deeper than MAX_STACK_DEPTH, never sampled.
+	static uint32_t generation; // Incremented when a run starts, so calls from a previous run leave the stack alone.
+
+	Thread thread;
+	SafeFlag exit_thread;
+	uint64_t interval_usec = DEFAULT_INTERVAL_USEC;
+	String output_file;
+
+	// Only accessed by the sampling thread until it finishes.
+	HashMap<String, uint64_t> stack_samples;
+	uint64_t sample_count = 0;
+	uint64_t idle_count = 0;
+
+	static void _thread_func(void *p_userdata);
+	void _take_sample();
+	void _report();
+
+	static void _profiler_toggle(void *p_user, bool p_enable, const Array &p_opts);
+
+public:
+	_FORCE_INLINE_ static GDScriptSamplingProfiler *get_running() { return running; }
+
+	// Called by the VM. `enter_function()` returns the line the VM must keep up to date while the
+	// function runs, or nullptr if the call isn't sampled (in which case `exit_function()` isn't called).
+	// The line is only written while `is_sampling()` is true for the returned generation.
+	SafeNumeric<int> *enter_function(GDScriptFunction *p_function, int p_line, uint32_t &r_generation);
+	static void exit_function(uint32_t p_generation);
+	_FORCE_INLINE_ static bool is_sampling(uint32_t p_generation) { return running && generation == p_generation; }
+	static uint32_t get_stack_depth() { return depth.get(); }
+
+	static void start(const String &p_output_file = String(), uint64_t p_interval_usec = DEFAULT_INTERVAL_USEC);
+	static void stop();
+
+	static void register_profiler();
+	static void unregister_profiler();
+};
+
+#endif // DEBUG_ENABLED
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
@@ -31,6 +31,7 @@
 #include "gdscript_tokenizer.h"
 
 #include "core/error/error_macros.h"
+#include "core/io/marshalls.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_settings.h"
@@ -1016,6 +1017,9 @@ void GDScriptTokenizer::check_indent() {
 		int indent_count = 0;
 
 		if (current_indent_char != ' ' && current_indent_char != '\t' && current_indent_char != '\r' && current_indent_char != '\n' && current_indent_char != '#') {
+			if (line_indents != nullptr) {
+				(*line_indents)[line] = line_continuation ? BINARY_LINE_CONTINUED : 0;
+			}
 			// First character of the line is not whitespace, so we clear all indentation levels.
 			// Unless we are in a continuation or in multiline mode (inside expression).
 			if (line_continuation || multiline_mode) {
@@ -1108,6 +1112,10 @@ void GDScriptTokenizer::check_indent() {
 			continue;
 		}
 
+		if (line_indents != nullptr) {
+			(*line_indents)[line] = line_continuation ? BINARY_LINE_CONTINUED : indent_count;
+		}
+
 		if (line_continuation || multiline_mode) {
 			// We cleared up all the whitespace at the beginning of the line.
 			// But if this is a continuation or multiline mode and we don't want any indentation change.
@@ -1239,6 +1247,10 @@ void GDScriptTokenizer::_skip_whitespace() {
 }
 
 GDScriptTokenizer::Token GDScriptTokenizer::scan() {
+	if (binary_mode) {
+		return binary_scan();
+	}
+
 	if (has_error()) {
 		return pop_error();
 	}
@@ -1507,6 +1519,335 @@ GDScriptTokenizer::Token GDScriptTokenizer::scan() {
 	}
 }
 
+// Binary token stream.
+
+#define BINARY_FORMAT_VERSION 1
+
+static void _encode_uint(Vector<uint8_t> &r_buffer, uint32_t p_value) {
+	// Variable length encoding, 7 bits per byte. Most values are small line/column numbers and indices.
+	do {
+		uint8_t byte = p_value & 0x7F;
+		p_value >>= 7;
+		if (p_value != 0) {
+			byte |= 0x80;
+		}
+		r_buffer.push_back(byte);
+	} while (p_value != 0);
+}
+
+static bool _decode_uint(const uint8_t *&r_ptr, const uint8_t *p_end, uint32_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 32; shift += 7) {
+		if (r_ptr >= p_end) {
+			return false;
+		}
+		uint8_t byte = *r_ptr++;
+		r_value |= uint32_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+Vector<uint8_t> GDScriptTokenizer::parse_code_string(const String &p_code) {
+	HashMap<int, int> indents;
+
+	GDScriptTokenizer tokenizer;
+	tokenizer.line_indents = &indents;
+	tokenizer.set_source_code(p_code);
+	// Don't generate whitespace tokens. Indentation is stored per line instead and resolved when reading
+	// the stream back, since it depends on the multiline mode the parser sets while parsing.
+	tokenizer.set_multiline_mode(true);
+
+	HashMap<StringName, uint32_t> identifier_map;
+	Vector<StringName> identifiers;
+	HashMap<Variant, uint32_t, VariantHasher, VariantComparator> constant_map;
+	Vector<Variant> constants;
+	Vector<uint8_t> token_data;
+	uint32_t token_count = 0;
+	int last_line = 0;
+
+	for (;;) {
+		Token token = tokenizer.scan();
+		if (token.type == Token::ERROR) {
+			return Vector<uint8_t>();
+		}
+
+		int indent = BINARY_LINE_SAME;
+		if (token.type == Token::TK_EOF) {
+			indent = 0;
+		} else if (token_count == 0 || token.start_line > last_line) {
+			const int *line_indent = indents.getptr(token.start_line);
+			ERR_FAIL_NULL_V_MSG(line_indent, Vector<uint8_t>(), "Tokenizer bug: missing indentation for line " + itos(token.start_line) + ".");
+			indent = *line_indent;
+		}
+		last_line = token.end_line;
+
+		token_data.push_back(token.type);
+		switch (token.type) {
+			case Token::IDENTIFIER:
+			case Token::ANNOTATION: {
+				StringName name = token.source;
+				if (!identifier_map.has(name)) {
+					identifier_map[name] = identifiers.size();
+					identifiers.push_back(name);
+				}
+				_encode_uint(token_data, identifier_map[name]);
+			} break;
+			case Token::LITERAL: {
+				if (!constant_map.has(token.literal)) {
+					constant_map[token.literal] = constants.size();
+					constants.push_back(token.literal);
+				}
+				_encode_uint(token_data, constant_map[token.literal]);
+			} break;
+			default:
+				break;
+		}
+		_encode_uint(token_data, token.start_line);
+		_encode_uint(token_data, token.end_line - token.start_line);
+		_encode_uint(token_data, token.start_column);
+		_encode_uint(token_data, token.end_column);
+		_encode_uint(token_data, indent - BINARY_LINE_CONTINUED);
+		token_count++;
+
+		if (token.type == Token::TK_EOF) {
+			break;
+		}
+	}
+
+	Vector<uint8_t> buffer;
+	buffer.resize(8);
+	buffer.write[0] = 'G';
+	buffer.write[1] = 'D';
+	buffer.write[2] = 'S';
+	buffer.write[3] = 'C';
+	encode_uint32(BINARY_FORMAT_VERSION, &buffer.write[4]);
+
+	_encode_uint(buffer, identifiers.size());
+	for (int i = 0; i < identifiers.size(); i++) {
+		CharString utf8 = String(identifiers[i]).utf8();
+		_encode_uint(buffer, utf8.length());
+		int offset = buffer.size();
+		buffer.resize(offset + utf8.length());
+		memcpy(buffer.ptrw() + offset, utf8.get_data(), utf8.length());
+	}
+
+	_encode_uint(buffer, constants.size());
+	for (int i = 0; i < constants.size(); i++) {
+		int len = 0;
+		Error err = encode_variant(constants[i], nullptr, len);
+		ERR_FAIL_COND_V_MSG(err != OK, Vector<uint8_t>(), "Can't encode GDScript constant for binary token stream.");
+		_encode_uint(buffer, len);
+		int offset = buffer.size();
+		buffer.resize(offset + len);
+		encode_variant(constants[i], buffer.ptrw() + offset, len);
+	}
+
+	_encode_uint(buffer, token_count);
+	buffer.append_array(token_data);
+
+	return buffer;
+}
+
+Error GDScriptTokenizer::set_code_buffer(const Vector<uint8_t> &p_buffer) {
+	const uint8_t *ptr = p_buffer.ptr();
+	const uint8_t *end = ptr + p_buffer.size();
+
+	ERR_FAIL_COND_V_MSG(p_buffer.size() < 8 || ptr[0] != 'G' || ptr[1] != 'D' || ptr[2] != 'S' || ptr[3] != 'C', ERR_INVALID_DATA, "Invalid GDScript binary token stream.");
+	uint32_t version = decode_uint32(ptr + 4);
+	ERR_FAIL_COND_V_MSG(version != BINARY_FORMAT_VERSION, ERR_INVALID_DATA, vformat("Unsupported GDScript binary token stream version %d (expected %d). The project needs to be exported again.", version, BINARY_FORMAT_VERSION));
+	ptr += 8;
+
+#define READ_UINT(m_value) \
+	ERR_FAIL_COND_V_MSG(!_decode_uint(ptr, end, m_value), ERR_INVALID_DATA, "Truncated GDScript binary token stream.")
+
+	uint32_t identifier_count;
+	READ_UINT(identifier_count);
+	Vector<StringName> identifiers;
+	identifiers.resize(identifier_count);
+	for (uint32_t i = 0; i < identifier_count; i++) {
+		uint32_t len;
+		READ_UINT(len);
+		ERR_FAIL_COND_V_MSG(uint32_t(end - ptr) < len, ERR_INVALID_DATA, "Truncated GDScript binary token stream.");
+		String name;
+		name.parse_utf8((const char *)ptr, len);
+		identifiers.write[i] = name;
+		ptr += len;
+	}
+
+	uint32_t constant_count;
+	READ_UINT(constant_count);
+	Vector<Variant> constants;
+	constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		uint32_t len;
+		READ_UINT(len);
+		ERR_FAIL_COND_V_MSG(uint32_t(end - ptr) < len, ERR_INVALID_DATA, "Truncated GDScript binary token stream.");
+		Error err = decode_variant(constants.write[i], ptr, len);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid constant in GDScript binary token stream.");
+		ptr += len;
+	}
+
+	uint32_t token_count;
+	READ_UINT(token_count);
+	ERR_FAIL_COND_V_MSG(token_count == 0, ERR_INVALID_DATA, "Empty GDScript binary token stream.");
+	binary_tokens.resize(token_count);
+	binary_indents.resize(token_count);
+	for (uint32_t i = 0; i < token_count; i++) {
+		ERR_FAIL_COND_V_MSG(ptr >= end, ERR_INVALID_DATA, "Truncated GDScript binary token stream.");
+		uint8_t type = *ptr++;
+		ERR_FAIL_COND_V_MSG(type >= Token::TK_MAX || type == Token::ERROR, ERR_INVALID_DATA, "Invalid token in GDScript binary token stream.");
+
+		Token token((Token::Type)type);
+		switch (token.type) {
+			case Token::IDENTIFIER:
+			case Token::ANNOTATION: {
+				uint32_t index;
+				READ_UINT(index);
+				ERR_FAIL_COND_V_MSG(index >= identifier_count, ERR_INVALID_DATA, "Invalid identifier in GDScript binary token stream.");
+				token.source = identifiers[index];
+				token.literal = identifiers[index];
+			} break;
+			case Token::LITERAL: {
+				uint32_t index;
+				READ_UINT(index);
+				ERR_FAIL_COND_V_MSG(index >= constant_count, ERR_INVALID_DATA, "Invalid constant in GDScript binary token stream.");
+				token.literal = constants[index];
+			} break;
+			default:
+				if (token.is_node_name()) {
+					// Keywords can be used as node names, which are taken from the source.
+					token.source = token_names[type];
+				}
+				break;
+		}
+
+		uint32_t start_line, line_count, start_column, end_column, indent;
+		READ_UINT(start_line);
+		READ_UINT(line_count);
+		READ_UINT(start_column);
+		READ_UINT(end_column);
+		READ_UINT(indent);
+		token.start_line = start_line;
+		token.end_line = start_line + line_count;
+		token.start_column = start_column;
+		token.end_column = end_column;
+		token.leftmost_column = start_column;
+		token.rightmost_column = end_column;
+
+		binary_tokens.write[i] = token;
+		binary_indents.write[i] = int(indent) + BINARY_LINE_CONTINUED;
+	}
+
+#undef READ_UINT
+
+	ERR_FAIL_COND_V_MSG(binary_tokens[token_count - 1].type != Token::TK_EOF, ERR_INVALID_DATA, "GDScript binary token stream doesn't end with an end of file token.");
+
+	binary_mode = true;
+	binary_position = 0;
+	binary_line_checked = false;
+	return OK;
+}
+
+void GDScriptTokenizer::binary_check_indent(int p_indent, int p_line) {
+	// Same rules as `check_indent()`, with the indentation already measured when serializing.
+	int previous_indent = 0;
+	if (indent_level() > 0) {
+		previous_indent = indent_stack.back()->get();
+	}
+	if (p_indent == previous_indent) {
+		// No change in indentation.
+		return;
+	}
+	if (p_indent > previous_indent) {
+		// Indentation increased.
+		indent_stack.push_back(p_indent);
+		pending_indents++;
+		return;
+	}
+
+	// Indentation decreased (dedent).
+	while (indent_level() > 0 && indent_stack.back()->get() > p_indent) {
+		indent_stack.pop_back();
+		pending_indents--;
+	}
+	if ((indent_level() > 0 && indent_stack.back()->get() != p_indent) || (indent_level() == 0 && p_indent != 0)) {
+		// Mismatched indentation alignment.
+		Token error(Token::ERROR);
+		error.literal = "Unindent doesn't match the previous indentation level.";
+		error.start_line = p_line;
+		error.end_line = p_line;
+		error.start_column = 1;
+		error.leftmost_column = 1;
+		error.end_column = p_indent + 1;
+		error.rightmost_column = p_indent + 1;
+		push_error(error);
+		// Still, we'll be lenient and keep going, so keep this level in the stack.
+		indent_stack.push_back(p_indent);
+	}
+}
+
+GDScriptTokenizer::Token GDScriptTokenizer::binary_scan() {
+	if (binary_position >= binary_tokens.size()) {
+		// Keep returning the end of file token.
+		return binary_tokens[binary_tokens.size() - 1];
+	}
+
+	const Token &token = binary_tokens[binary_position];
+
+	if (!binary_line_checked) {
+		binary_line_checked = true;
+		int indent = binary_indents[binary_position];
+		if (indent >= 0) {
+			if (token.type == Token::TK_EOF) {
+				// Send dedents for every indent level.
+				pending_indents -= indent_level();
+				indent_stack.clear();
+			} else if (!multiline_mode) {
+				binary_check_indent(indent, token.start_line);
+			}
+			if (binary_position > 0 && !multiline_mode) {
+				const Token &previous = binary_tokens[binary_position - 1];
+				Token newline(Token::NEWLINE);
+				newline.start_line = previous.end_line;
+				newline.end_line = previous.end_line;
+				newline.start_column = previous.end_column;
+				newline.end_column = previous.end_column + 1;
+				newline.leftmost_column = newline.start_column;
+				newline.rightmost_column = newline.end_column;
+				return newline;
+			}
+		}
+	}
+
+	if (has_error()) {
+		return pop_error();
+	}
+
+	if (pending_indents != 0) {
+		Token indent(pending_indents > 0 ? Token::INDENT : Token::DEDENT);
+		indent.start_line = token.start_line;
+		indent.end_line = token.start_line;
+		indent.start_column = 1;
+		indent.leftmost_column = 1;
+		if (pending_indents > 0) {
+			pending_indents--;
+			indent.end_column = token.start_column;
+		} else {
+			pending_indents++;
+			indent.end_column = token.start_column + 1;
+		}
+		indent.rightmost_column = indent.end_column;
+		return indent;
+	}
+
+	binary_position++;
+	binary_line_checked = false;
+	return token;
+}
+
 GDScriptTokenizer::GDScriptTokenizer() {
 #ifdef TOOLS_ENABLED
 	if (EditorSettings::get_singleton()) {
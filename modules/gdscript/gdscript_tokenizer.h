@@ -229,6 +229,18 @@ private:
 	HashMap<int, CommentData> comments;
 #endif // TOOLS_ENABLED
 
+	// Binary token stream (see `parse_code_string()`).
+	enum {
+		BINARY_LINE_SAME = -1, // Token doesn't start a line.
+		BINARY_LINE_CONTINUED = -2, // Token starts a line after a backslash line continuation.
+	};
+	bool binary_mode = false;
+	Vector<Token> binary_tokens;
+	Vector<int> binary_indents; // Indentation of the line each token starts, or one of the values above.
+	int binary_position = 0;
+	bool binary_line_checked = false;
+	HashMap<int, int> *line_indents = nullptr; // Only set while serializing.
+
 	_FORCE_INLINE_ bool _is_at_end() { return position >= length; }
 	_FORCE_INLINE_ char32_t _peek(int p_offset = 0) { return position + p_offset >= 0 && position + p_offset < length ? _current[p_offset] : '\0'; }
 	int indent_level() const { return indent_stack.size(); }
@@ -256,11 +268,19 @@ private:
 	Token string();
 	Token annotation();
 
+	Token binary_scan();
+	void binary_check_indent(int p_indent, int p_line);
+
 public:
 	Token scan();
 
 	void set_source_code(const String &p_source_code);
 
+	// Compact serialized token stream, used for exported scripts so they don't need to be tokenized again when loaded.
+	// Returns an empty buffer if the code has tokenizer errors.
+	static Vector<uint8_t> parse_code_string(const String &p_code);
+	Error set_code_buffer(const Vector<uint8_t> &p_buffer);
+
 	int get_cursor_line() const;
 	int get_cursor_column() const;
 	void set_cursor_position(int p_line, int p_column);
@@ -167,21 +167,21 @@ struct GDScriptUtilityFunctionsDefinitions {
 				VALIDATE_ARG_NUM(0);
 				VALIDATE_ARG_NUM(1);
 
-				int from = *p_args[0];
-				int to = *p_args[1];
+				int64_t from = *p_args[0];
+				int64_t to = *p_args[1];
 
 				Array arr;
 				if (from >= to) {
 					*r_ret = arr;
 					return;
 				}
-				Error err = arr.resize(to - from);
+				Error err = to - from > INT32_MAX ? ERR_OUT_OF_MEMORY : arr.resize(to - from);
 				if (err != OK) {
 					r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
 					*r_ret = Variant();
 					return;
 				}
-				for (int i = from; i < to; i++) {
+				for (int64_t i = from; i < to; i++) {
 					arr[i - from] = i;
 				}
 				*r_ret = arr;
@@ -191,9 +191,9 @@ struct GDScriptUtilityFunctionsDefinitions {
 				VALIDATE_ARG_NUM(1);
 				VALIDATE_ARG_NUM(2);
 
-				int from = *p_args[0];
-				int to = *p_args[1];
-				int incr = *p_args[2];
+				int64_t from = *p_args[0];
+				int64_t to = *p_args[1];
+				int64_t incr = *p_args[2];
 				if (incr == 0) {
 					*r_ret = RTR("Step argument is zero!");
 					r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
@@ -211,14 +211,14 @@ struct GDScriptUtilityFunctionsDefinitions {
 				}
 
 				// Calculate how many.
-				int count = 0;
+				int64_t count = 0;
 				if (incr > 0) {
 					count = ((to - from - 1) / incr) + 1;
 				} else {
 					count = ((from - to - 1) / -incr) + 1;
 				}
 
-				Error err = arr.resize(count);
+				Error err = count > INT32_MAX ? ERR_OUT_OF_MEMORY : arr.resize(count);
 
 				if (err != OK) {
 					r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
@@ -228,12 +228,12 @@ struct GDScriptUtilityFunctionsDefinitions {
 
 				if (incr > 0) {
 					int idx = 0;
-					for (int i = from; i < to; i += incr) {
+					for (int64_t i = from; i < to; i += incr) {
 						arr[idx++] = i;
 					}
 				} else {
 					int idx = 0;
-					for (int i = from; i > to; i += incr) {
+					for (int64_t i = from; i > to; i += incr) {
 						arr[idx++] = i;
 					}
 				}
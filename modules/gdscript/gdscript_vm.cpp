@@ -34,6 +34,7 @@
 #include "core/os/os.h"
 #include "gdscript.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
 Variant *GDScriptFunction::_get_variant(int p_address, GDScriptInstance *p_instance, Variant *p_stack, String &r_error) const {
 	int address = p_address & ADDR_MASK;
@@ -68,6 +69,57 @@ Variant *GDScriptFunction::_get_variant(int p_address, GDScriptInstance *p_insta
 	return nullptr;
 }
 
+GDScriptInstance *GDScriptFunction::_get_member_cache_instance(const Variant *p_base) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return nullptr;
+	}
+	ScriptInstance *si = obj->get_script_instance();
+	if (!si || si->is_placeholder() || si->get_language() != GDScriptLanguage::get_singleton()) {
+		return nullptr;
+	}
+#ifdef DEBUG_ENABLED
+	if (unlikely(!static_cast<GDScriptInstance *>(si)->is_accessible_from_caller_thread())) {
+		return nullptr; // Let the regular path report the error.
+	}
+#endif
+	return static_cast<GDScriptInstance *>(si);
+}
+
+uint32_t GDScriptFunction::_get_cached_member_index(const SafeNumeric<uint64_t> &p_cache, const GDScriptInstance *p_instance) {
+	if (!p_instance) {
+		return UINT32_MAX;
+	}
+	uint64_t cached = p_cache.get();
+	uint32_t member_index = cached & 0xFFFFFFFF;
+	// Instances may not have their members resized yet right after a reload.
+	if (uint32_t(cached >> 32) != p_instance->script->member_cache_id || member_index >= uint32_t(p_instance->members.size())) {
+		return UINT32_MAX;
+	}
+	return member_index;
+}
+
+void GDScriptFunction::_update_member_cache(SafeNumeric<uint64_t> &p_cache, const GDScriptInstance *p_instance, const StringName &p_name, bool p_get) {
+	if (!p_instance) {
+		return;
+	}
+	HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = p_instance->script->member_indices.find(p_name);
+	if (!E) {
+		return;
+	}
+	if (p_get) {
+		if (E->value.getter) {
+			return;
+		}
+	} else if (E->value.setter || E->value.data_type.has_type) {
+		return;
+	}
+	p_cache.set((uint64_t(p_instance->script->member_cache_id) << 32) | uint32_t(E->value.index));
+}
+
 #ifdef DEBUG_ENABLED
 static String _get_script_name(const Ref<Script> p_script) {
 	Ref<GDScript> gdscript = p_script;
@@ -232,6 +284,23 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_OPERATOR_ADD_INT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,              \
+		&&OPCODE_OPERATOR_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_LESS_INT,                  \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,            \
+		&&OPCODE_OPERATOR_GREATER_INT,               \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,         \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,            \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,            \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,              \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,          \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,             \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,       \
 		&&OPCODE_EXTENDS_TEST,                       \
 		&&OPCODE_IS_BUILTIN,                         \
 		&&OPCODE_SET_KEYED,                          \
@@ -511,6 +580,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		defarg = p_state->defarg;
 
 	} else {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_V_MSG(p_instance && !_thread_safe && !p_instance->is_accessible_from_caller_thread(), _get_default_variant_for_data_type(return_type),
+				vformat("Cannot call \"%s()\" from a thread-safe function, as it isn't marked \"@thread_safe\" and the instance belongs to another thread.", name));
+#endif
+
 		if (p_argcount != _argument_count) {
 			if (p_argcount > _argument_count) {
 				r_err.error = Callable::CallError::CALL_ERROR_TOO_MANY_ARGUMENTS;
@@ -589,6 +663,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	memnew_placement(&stack[ADDR_STACK_NIL], Variant);
 
 	String err_text;
+	bool stack_moved = false; // Set when awaiting, as the stack then belongs to the function state.
 
 #ifdef DEBUG_ENABLED
 
@@ -636,8 +711,17 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		profile.call_count++;
 		profile.frame_call_count++;
 	}
+	SafeNumeric<int> *sampled_line = nullptr;
+	uint32_t sampled_generation = 0;
+	if (unlikely(GDScriptSamplingProfiler::get_running())) {
+		sampled_line = GDScriptSamplingProfiler::get_running()->enter_function(this, line, sampled_generation);
+	}
 	bool exit_ok = false;
 	bool awaited = false;
+
+	if (_thread_safe) {
+		_thread_safe_depth++;
+	}
 #endif
 
 #ifdef DEBUG_ENABLED
@@ -706,6 +790,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_RAW(m_name, m_operand_type, m_result_type, m_op)                                                                       \
+	OPCODE(OPCODE_OPERATOR_##m_name) {                                                                                                         \
+		CHECK_SPACE(4);                                                                                                                        \
+		GET_INSTRUCTION_ARG(a, 0);                                                                                                             \
+		GET_INSTRUCTION_ARG(b, 1);                                                                                                             \
+		GET_INSTRUCTION_ARG(dst, 2);                                                                                                           \
+		*VariantInternal::get_##m_result_type(dst) = *VariantInternal::get_##m_operand_type(a) m_op *VariantInternal::get_##m_operand_type(b); \
+		ip += 4;                                                                                                                               \
+	}                                                                                                                                          \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_RAW(ADD_INT, int, int, +);
+			OPCODE_OPERATOR_RAW(SUBTRACT_INT, int, int, -);
+			OPCODE_OPERATOR_RAW(MULTIPLY_INT, int, int, *);
+			OPCODE_OPERATOR_RAW(EQUAL_INT, int, bool, ==);
+			OPCODE_OPERATOR_RAW(NOT_EQUAL_INT, int, bool, !=);
+			OPCODE_OPERATOR_RAW(LESS_INT, int, bool, <);
+			OPCODE_OPERATOR_RAW(LESS_EQUAL_INT, int, bool, <=);
+			OPCODE_OPERATOR_RAW(GREATER_INT, int, bool, >);
+			OPCODE_OPERATOR_RAW(GREATER_EQUAL_INT, int, bool, >=);
+			OPCODE_OPERATOR_RAW(ADD_FLOAT, float, float, +);
+			OPCODE_OPERATOR_RAW(SUBTRACT_FLOAT, float, float, -);
+			OPCODE_OPERATOR_RAW(MULTIPLY_FLOAT, float, float, *);
+			OPCODE_OPERATOR_RAW(DIVIDE_FLOAT, float, float, /);
+			OPCODE_OPERATOR_RAW(LESS_FLOAT, float, bool, <);
+			OPCODE_OPERATOR_RAW(LESS_EQUAL_FLOAT, float, bool, <=);
+			OPCODE_OPERATOR_RAW(GREATER_FLOAT, float, bool, >);
+			OPCODE_OPERATOR_RAW(GREATER_EQUAL_FLOAT, float, bool, >=);
+
 			OPCODE(OPCODE_EXTENDS_TEST) {
 				CHECK_SPACE(4);
 
@@ -984,7 +1097,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_INSTRUCTION_ARG(dst, 0);
 				GET_INSTRUCTION_ARG(value, 1);
@@ -994,17 +1107,32 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _member_caches_count);
+				SafeNumeric<uint64_t> &cache = _member_caches_ptr[cache_idx];
+
+				GDScriptInstance *dst_instance = _get_member_cache_instance(dst);
+				uint32_t member_index = _get_cached_member_index(cache, dst_instance);
+				if (member_index != UINT32_MAX) {
+					dst_instance->members.write[member_index] = *value;
+#ifdef TOOLS_ENABLED
+					dst_instance->owner->set_edited(true);
+#endif
+				} else {
+					bool valid;
+					dst->set_named(*index, *value, valid);
 
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					String err_type;
-					err_text = "Invalid set index '" + String(*index) + "' (on base: '" + _get_var_type(dst) + "') with value of type '" + _get_var_type(value) + "'.";
-					OPCODE_BREAK;
-				}
+					if (!valid) {
+						String err_type;
+						err_text = "Invalid set index '" + String(*index) + "' (on base: '" + _get_var_type(dst) + "') with value of type '" + _get_var_type(value) + "'.";
+						OPCODE_BREAK;
+					}
 #endif
-				ip += 4;
+					// Setters and typed members need to go through the instance.
+					_update_member_cache(cache, _get_member_cache_instance(dst), *index, false);
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1024,7 +1152,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_INSTRUCTION_ARG(src, 0);
 				GET_INSTRUCTION_ARG(dst, 1);
@@ -1034,22 +1162,31 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _member_caches_count);
+				SafeNumeric<uint64_t> &cache = _member_caches_ptr[cache_idx];
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				GDScriptInstance *src_instance = _get_member_cache_instance(src);
+				uint32_t member_index = _get_cached_member_index(cache, src_instance);
+				if (member_index != UINT32_MAX) {
+					// Copy first, src and dst may be the same stack position and hold the last reference to the instance.
+					Variant ret = src_instance->members[member_index];
+					*dst = ret;
+				} else {
+					// Allow better error message in cases where src and dst are the same stack position.
+					bool valid;
+					Variant ret = src->get_named(*index, valid);
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
+						OPCODE_BREAK;
+					}
 #endif
-				ip += 4;
+					// Getters need to go through the instance.
+					_update_member_cache(cache, _get_member_cache_instance(src), *index, true);
+					*dst = ret;
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -2204,12 +2341,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					// Move the stack to the state instead of copying it, so suspending doesn't copy or
+					// release any value. When resuming from a state, the stack already lives there.
+					if (p_state) {
+						gdfs->state.stack = p_state->stack;
+						p_state->stack = Vector<uint8_t>();
+						p_state->stack_size = 0;
+					} else {
+						gdfs->state.stack.resize(alloca_size);
+						// First 3 stack addresses are special, so we just skip them here.
+						memcpy(gdfs->state.stack.ptrw() + sizeof(Variant) * 3, (void *)&stack[3], sizeof(Variant) * (_stack_size - 3));
 					}
+					stack_moved = true;
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
 					gdfs->state.ip = ip + 2;
@@ -2846,7 +2989,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				if (!array->is_empty()) {
 					GET_INSTRUCTION_ARG(iterator, 2);
-					*iterator = array->get(0);
+					*iterator = (*(const Array *)array)[0];
 
 					// Skip regular iterate.
 					ip += 5;
@@ -2871,7 +3014,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			GET_INSTRUCTION_ARG(iterator, 2);                                                                              \
 			VariantInternal::initialize(iterator, Variant::m_var_ret_type);                                                \
 			m_ret_type *it = VariantInternal::m_ret_get_func(iterator);                                                    \
-			*it = array->get(0);                                                                                           \
+			*it = array->ptr()[0];                                                                                         \
 			ip += 5;                                                                                                       \
 		} else {                                                                                                           \
 			int jumpto = _code_ptr[ip + 4];                                                                                \
@@ -3185,7 +3328,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip = jumpto;
 				} else {
 					GET_INSTRUCTION_ARG(iterator, 2);
-					*iterator = array->get(*idx);
+					*iterator = (*array)[*idx]; // Bounds were checked above, assign without an intermediate copy.
 
 					ip += 5; // Loop again.
 				}
@@ -3206,7 +3349,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			ip = jumpto;                                                                            \
 		} else {                                                                                    \
 			GET_INSTRUCTION_ARG(iterator, 2);                                                       \
-			*VariantInternal::m_ret_get_func(iterator) = array->get(*idx);                          \
+			*VariantInternal::m_ret_get_func(iterator) = array->ptr()[*idx];                        \
 			ip += 5;                                                                                \
 		}                                                                                           \
 	}                                                                                               \
@@ -3393,6 +3536,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
+#ifdef DEBUG_ENABLED
+				if (unlikely(sampled_line) && GDScriptSamplingProfiler::is_sampling(sampled_generation)) {
+					sampled_line->set(line);
+				}
+#endif
+
 				if (EngineDebugger::is_active()) {
 					// line
 					bool do_break = false;
@@ -3483,6 +3632,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		GDScriptLanguage::get_singleton()->script_frame_time += time_taken - function_call_time;
 	}
 
+	if (sampled_line) {
+		GDScriptSamplingProfiler::exit_function(sampled_generation);
+	}
+
+	if (_thread_safe) {
+		_thread_safe_depth--;
+	}
+
 	// Check if this is not the last time it was interrupted by `await` or if it's the first time executing.
 	// If that is the case then we exit the function as normal. Otherwise we postpone it until the last `await` is completed.
 	// This ensures the call stack can be properly shown when using `await`, showing what resumed the function.
@@ -3493,8 +3650,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 		// Free stack, except reserved addresses.
-		for (int i = 3; i < _stack_size; i++) {
-			stack[i].~Variant();
+		if (!stack_moved) {
+			for (int i = 3; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
+			if (p_state) {
+				p_state->stack_size = 0;
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
@@ -37,6 +37,7 @@
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_utility_functions.h"
 
@@ -85,8 +86,19 @@ public:
 			return;
 		}
 
-		// TODO: Re-add compiled GDScript on export.
-		return;
+		// TODO: Re-add encrypted GDScript on export.
+		Error err;
+		String source = FileAccess::get_file_as_string(p_path, &err);
+		ERR_FAIL_COND_MSG(err != OK, "Failed to read script '" + p_path + "' for export.");
+
+		Vector<uint8_t> binary_tokens = GDScriptTokenizer::parse_code_string(source);
+		if (binary_tokens.is_empty()) {
+			// Keep the source, so the tokenizer errors are reported when the script is loaded.
+			WARN_PRINT("Script '" + p_path + "' has tokenizer errors, exporting it as text.");
+			return;
+		}
+
+		add_file(p_path.get_basename() + ".gdc", binary_tokens, true);
 	}
 
 	virtual String _get_name() const override { return "GDScript"; }
@@ -129,6 +141,10 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		gdscript_cache = memnew(GDScriptCache);
 
 		GDScriptUtilityFunctions::register_functions();
+
+#ifdef DEBUG_ENABLED
+		GDScriptSamplingProfiler::register_profiler();
+#endif
 	}
 
 #ifdef TOOLS_ENABLED
@@ -143,6 +159,10 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
+#ifdef DEBUG_ENABLED
+		GDScriptSamplingProfiler::unregister_profiler();
+#endif
+
 		ScriptServer::unregister_language(script_language_gd);
 
 		if (gdscript_cache) {
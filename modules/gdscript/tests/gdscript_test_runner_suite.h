@@ -32,6 +32,9 @@
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
 #include "gdscript_test_runner.h"
+
+#include "../gdscript_parser.h"
+#include "../gdscript_tokenizer.h"
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -69,6 +72,61 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Load binary tokens and run them") {
+	const String code = R"(
+extends RefCounted
+
+const VALUES = [
+	1, 2,
+		3,
+]
+
+func _init():
+	var total := 0
+	for value in VALUES:
+		if value > 1:
+			total += value
+		else:
+			total -= value
+	var add := func(a, b):
+		return a + b
+	total = add.call(total, \
+			10)
+	match total:
+		14:
+			set_meta("result", "ok")
+		_:
+			set_meta("result", total)
+)";
+
+	const Vector<uint8_t> binary_tokens = GDScriptTokenizer::parse_code_string(code);
+	REQUIRE_MESSAGE(!binary_tokens.is_empty(), "The code should be serialized to binary tokens.");
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_binary_tokens_source(binary_tokens);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(error == OK, "The binary tokens should parse successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	CHECK_MESSAGE(ref_counted->get_meta("result") == Variant("ok"), "The script loaded from binary tokens should behave like its source.");
+
+	SUBCASE("Code with tokenizer errors is not serialized") {
+		CHECK(GDScriptTokenizer::parse_code_string("var a = (1 + 2]\n").is_empty());
+	}
+
+	SUBCASE("Invalid binary tokens are rejected") {
+		Vector<uint8_t> invalid = binary_tokens;
+		invalid.resize(invalid.size() / 2);
+		GDScriptParser parser;
+		ERR_PRINT_OFF;
+		CHECK(parser.parse_binary(invalid, "") != OK);
+		ERR_PRINT_ON;
+	}
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,11 @@
+func unsafe_helper(value: int) -> int:
+	return value * 2
+
+
+@thread_safe
+func compute(value: int) -> int:
+	return unsafe_helper(value)
+
+
+func test():
+	print(compute(1))
@@ -0,0 +1,10 @@
+signal finished(value: int)
+
+
+@thread_safe
+func compute(value: int) -> void:
+	finished.emit(value * 2)
+
+
+func test():
+	compute(1)
@@ -0,0 +1,10 @@
+extends Node
+
+
+@thread_safe
+func get_child_name() -> String:
+	return $Child.name
+
+
+func test():
+	print(get_child_name())
@@ -0,0 +1,10 @@
+var counter := 0
+
+
+@thread_safe
+func add(value: int) -> int:
+	return counter + value
+
+
+func test():
+	print(add(1))
@@ -0,0 +1,10 @@
+extends Node
+
+
+@thread_safe
+func get_unique_name() -> String:
+	return %Unique.name
+
+
+func test():
+	print(get_unique_name())
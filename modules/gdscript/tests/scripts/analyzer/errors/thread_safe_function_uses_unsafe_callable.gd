@@ -0,0 +1,12 @@
+func unsafe_helper(value: int) -> int:
+	return value * 2
+
+
+@thread_safe
+func get_helper() -> Callable:
+	var helper := unsafe_helper
+	return helper
+
+
+func test():
+	print(get_helper().call(1))
@@ -0,0 +1,4 @@
+func test():
+	var step := 0
+	for i in range(0, 10, step):
+		print(i)
@@ -0,0 +1,50 @@
+var member := 1.5
+var untyped_member = 2
+
+
+func test():
+	var a := 3
+	var b := 4
+
+	var sum: int = a + b
+	sum = sum * 2 + a
+	print(sum)
+
+	# Operands which are also the assignment target.
+	sum = sum - a
+	sum += b
+	print(sum)
+
+	# Locals reusing the stack slot of a variable of another type.
+	if a > 10:
+		var text := "unused"
+		print(text)
+	else:
+		var product: int = a * b
+		product = a * b * 2
+		print(product)
+
+	var untyped = a + b
+	untyped = untyped * 1.5
+	print(untyped)
+
+	var negated := -a
+	negated = -b
+	print(negated)
+
+	member = member * 2.0
+	member = a * 0.5
+	untyped_member = untyped_member + a
+	print(member)
+	print(untyped_member)
+
+	print(defaults(1))
+
+	for i in 3:
+		var doubled: int = i + i
+		doubled = doubled + i
+		print(doubled)
+
+
+func defaults(x, y = x + 1, z: int = x * 2):
+	return x + y + z
@@ -0,0 +1,35 @@
+# Many coroutines suspended on the same signal at once.
+
+class Emitter:
+	signal done
+
+signal tick
+
+var completed := 0
+
+func worker(id: int) -> void:
+	var values := [id, Transform3D(), "text %d" % id]
+	await tick
+	values.append(id)
+	await tick
+	if values[0] == id and values[3] == id and values[2] == "text %d" % id:
+		completed += 1
+
+func abandoned(done: Signal, data: Array) -> void:
+	await done
+	data.append(true)
+
+func test():
+	for i in 10000:
+		worker(i)
+	tick.emit()
+	print(completed)
+	tick.emit()
+	print(completed)
+
+	# Coroutines which are never resumed are released with their emitter.
+	var data := []
+	var emitter := Emitter.new()
+	abandoned(emitter.done, data)
+	emitter = null
+	print(data.size())
@@ -0,0 +1,28 @@
+# Constants and names are pooled for the whole script, including inner classes and lambdas.
+const GREETING = "hello"
+
+
+class Inner:
+	var value := 1.5
+
+	func describe() -> String:
+		return "inner %s %s" % [GREETING, value]
+
+
+func first() -> Array:
+	return [GREETING, 1, 1.0, Vector2(1, 2)]
+
+
+func second() -> Array:
+	return [1.0, "other", 1, Vector2(1, 2), GREETING]
+
+
+func test():
+	var a := first()
+	var b := second()
+	print(a[0], " ", typeof(a[1]), " ", typeof(a[2]), " ", a[3])
+	print(b[1], " ", typeof(b[0]), " ", typeof(b[2]), " ", b[3], " ", b[4])
+	print(Inner.new().describe())
+
+	var lambda := func(): return [GREETING, 2, "lambda"]
+	print(lambda.call())
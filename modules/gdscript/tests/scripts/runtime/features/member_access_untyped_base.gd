@@ -0,0 +1,29 @@
+class A:
+	var value = 1
+	var typed: int = 2
+	var with_setter = 0:
+		set(v):
+			with_setter = v * 10
+
+class B:
+	var other = "other"
+	var value = "b"
+
+
+func read_value(obj):
+	return obj.value
+
+
+func test():
+	var objects = [A.new(), B.new(), A.new(), {"value": "dictionary"}]
+	# The same access site sees different classes.
+	for _i in 2:
+		for obj in objects:
+			print(read_value(obj))
+
+	var a = A.new()
+	for i in 3:
+		a.value = i
+		a.typed = i * 2
+		a.with_setter = i
+		print(a.value, " ", a.typed, " ", a.with_setter)
@@ -0,0 +1,57 @@
+func collect_range(from, to = null, step = null) -> Array:
+	var result := []
+	if to == null:
+		for i in range(from):
+			result.push_back(i)
+	elif step == null:
+		for i in range(from, to):
+			result.push_back(i)
+	else:
+		for i in range(from, to, step):
+			result.push_back(i)
+	return result
+
+
+func test():
+	var count: int = 5
+	var numbers := []
+	for i in range(count):
+		numbers.push_back(i)
+	print(numbers)
+
+	print(collect_range(3.7))
+	print(collect_range(2, 6))
+	print(collect_range(6, 2))
+	print(collect_range(6, 2, -1))
+	print(collect_range(1.5, 4.9))
+	print(collect_range(0, 10, 3))
+
+	# Bounds outside the 32-bit range can't be counted in place, "range()" is called instead.
+	var big := 3000000000
+	print(collect_range(big, big + 3))
+	print(collect_range(big + 4, big, -2))
+	print(collect_range(-big, -big + 2))
+	for i in range(3000000000, 3000000002):
+		print(i)
+
+	var points := PackedVector3Array([Vector3(1, 2, 3), Vector3(4, 5, 6)])
+	var sum := Vector3()
+	for point in points:
+		sum += point
+	print(sum)
+
+	var words := PackedStringArray(["a", "b", "c"])
+	var joined := ""
+	for word in words:
+		joined += word
+	print(joined)
+
+	var nodes: Array[Node] = []
+	for i in range(3):
+		var node := Node.new()
+		node.name = "Node%d" % i
+		nodes.push_back(node)
+	for node in nodes:
+		print(node.name)
+	for node in nodes:
+		node.free()
@@ -0,0 +1,23 @@
+const SCALE = 3
+
+
+static func offset(value: int) -> int:
+	return value + 1
+
+
+@thread_safe
+func scale(value: int) -> int:
+	return value * SCALE
+
+
+@thread_safe
+func sum_scaled(values: Array) -> int:
+	var total := 0
+	for value in values:
+		total += offset(scale(value))
+	var double := func(x): return x * 2
+	return double.call(total)
+
+
+func test():
+	print(sum_scaled([1, 2, 3]))
@@ -0,0 +1,25 @@
+func test():
+	var a := 7
+	var b := -3
+	print(a + b)
+	print(a - b)
+	print(a * b)
+	print(a == 7, a != 7)
+	print(a < b, a <= 7, a > b, a >= 8)
+
+	var x := 2.5
+	var y := 0.5
+	print(x + y)
+	print(x - y)
+	print(x * y)
+	print(x / y)
+	print(x < y, x <= 2.5, x > y, x >= 3.0)
+	print(x / 0.0)
+
+	var total := 0
+	var scale := 1.0
+	for i in 10:
+		total = total + i * i
+		scale = scale * 1.5
+	print(total)
+	print(scale > 57.0 and scale < 58.0)
@@ -0,0 +1,106 @@
+/*************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_GDSCRIPT_SAMPLING_PROFILER_H
+#define TEST_GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGDScriptSamplingProfiler {
+
+static void _start_profiler() {
+	GDScriptSamplingProfiler::start();
+}
+
+static void _stop_profiler() {
+	GDScriptSamplingProfiler::stop();
+}
+
+static int _get_stack_depth() {
+	return GDScriptSamplingProfiler::get_stack_depth();
+}
+
+TEST_CASE("[Modules][GDScript] Restart the sampling profiler from a profiled call") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func run(stop: Callable, start: Callable, depth: Callable) -> Array:
+	var depths := [depth.call()]
+	depths.append_array(restart(stop, start, depth))
+	depths.push_back(depth.call())
+	return depths
+
+func restart(stop: Callable, start: Callable, depth: Callable) -> Array:
+	stop.call()
+	start.call()
+	var depths := [depth.call(), leaf(depth)]
+	return depths
+
+func leaf(depth: Callable) -> int:
+	return depth.call()
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+
+	Ref<RefCounted> instance = memnew(RefCounted);
+	instance->set_script(gdscript);
+
+	// Stopping prints the report.
+	OS::get_singleton()->set_stdout_enabled(false);
+	GDScriptSamplingProfiler::start();
+	Array depths = instance->call("run", callable_mp_static(&_stop_profiler), callable_mp_static(&_start_profiler), callable_mp_static(&_get_stack_depth));
+
+	// Calls entered before the restart keep running, but leave the new stack alone.
+	CHECK(GDScriptSamplingProfiler::get_running() != nullptr);
+	CHECK(GDScriptSamplingProfiler::get_stack_depth() == 0);
+	GDScriptSamplingProfiler::stop();
+	OS::get_singleton()->set_stdout_enabled(true);
+
+	REQUIRE(depths.size() == 4);
+	CHECK(int(depths[0]) == 1);
+	CHECK(int(depths[1]) == 0);
+	CHECK(int(depths[2]) == 1);
+	CHECK(int(depths[3]) == 0);
+}
+
+} // namespace TestGDScriptSamplingProfiler
+
+#endif // DEBUG_ENABLED
+
+#endif // TEST_GDSCRIPT_SAMPLING_PROFILER_H
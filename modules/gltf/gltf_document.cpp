@@ -1304,7 +1304,32 @@ Error GLTFDocument::_encode_buffer_view(Ref<GLTFState> state, const double *src,
 	return OK;
 }
 
-Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, double *dst, const GLTFBufferViewIndex p_buffer_view, const int skip_every, const int skip_bytes, const int element_size, const int count, const GLTFType type, const int component_count, const int component_type, const int component_size, const bool normalized, const int byte_offset, const bool for_vertex) {
+// Converts the components straight to the destination type. The value still goes through a
+// double, so that the result is the same as when every accessor was decoded as doubles.
+template <class S, class T>
+static void _decode_components(T *__restrict r_dst, const uint8_t *p_src, const int p_count, const int p_stride, const int p_component_count, const int p_skip_every, const int p_skip_bytes, const double p_normalize_div) {
+	for (int i = 0; i < p_count; i++) {
+		const uint8_t *src = p_src + i * p_stride;
+
+		for (int j = 0; j < p_component_count; j++) {
+			if (p_skip_every && j > 0 && (j % p_skip_every) == 0) {
+				src += p_skip_bytes;
+			}
+
+			S s;
+			memcpy(&s, src, sizeof(S));
+			if (p_normalize_div != 0.0) {
+				*r_dst++ = T(double(s) / p_normalize_div);
+			} else {
+				*r_dst++ = T(double(s));
+			}
+			src += sizeof(S);
+		}
+	}
+}
+
+template <class T>
+Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, T *dst, const GLTFBufferViewIndex p_buffer_view, const int skip_every, const int skip_bytes, const int element_size, const int count, const GLTFType type, const int component_count, const int component_type, const int component_size, const bool normalized, const int byte_offset, const bool for_vertex) {
 	const Ref<GLTFBufferView> bv = state->buffer_views[p_buffer_view];
 
 	int stride = element_size;
@@ -1330,61 +1355,32 @@ Error GLTFDocument::_decode_buffer_view(Ref<GLTFState> state, double *dst, const
 
 	ERR_FAIL_COND_V((int)(offset + buffer_end) > buffer.size(), ERR_PARSE_ERROR);
 
-	//fill everything as doubles
+	const uint8_t *src = &bufptr[offset];
 
-	for (int i = 0; i < count; i++) {
-		const uint8_t *src = &bufptr[offset + i * stride];
-
-		for (int j = 0; j < component_count; j++) {
-			if (skip_every && j > 0 && (j % skip_every) == 0) {
-				src += skip_bytes;
-			}
-
-			double d = 0;
-
-			switch (component_type) {
-				case COMPONENT_TYPE_BYTE: {
-					int8_t b = int8_t(*src);
-					if (normalized) {
-						d = (double(b) / 128.0);
-					} else {
-						d = double(b);
-					}
-				} break;
-				case COMPONENT_TYPE_UNSIGNED_BYTE: {
-					uint8_t b = *src;
-					if (normalized) {
-						d = (double(b) / 255.0);
-					} else {
-						d = double(b);
-					}
-				} break;
-				case COMPONENT_TYPE_SHORT: {
-					int16_t s = *(int16_t *)src;
-					if (normalized) {
-						d = (double(s) / 32768.0);
-					} else {
-						d = double(s);
-					}
-				} break;
-				case COMPONENT_TYPE_UNSIGNED_SHORT: {
-					uint16_t s = *(uint16_t *)src;
-					if (normalized) {
-						d = (double(s) / 65535.0);
-					} else {
-						d = double(s);
-					}
-				} break;
-				case COMPONENT_TYPE_INT: {
-					d = *(int *)src;
-				} break;
-				case COMPONENT_TYPE_FLOAT: {
-					d = *(float *)src;
-				} break;
+	switch (component_type) {
+		case COMPONENT_TYPE_BYTE: {
+			_decode_components<int8_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 128.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_UNSIGNED_BYTE: {
+			_decode_components<uint8_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 255.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_SHORT: {
+			_decode_components<int16_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 32768.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_UNSIGNED_SHORT: {
+			_decode_components<uint16_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, normalized ? 65535.0 : 0.0);
+		} break;
+		case COMPONENT_TYPE_INT: {
+			_decode_components<int32_t>(dst, src, count, stride, component_count, skip_every, skip_bytes, 0.0);
+		} break;
+		case COMPONENT_TYPE_FLOAT: {
+			_decode_components<float>(dst, src, count, stride, component_count, skip_every, skip_bytes, 0.0);
+		} break;
+		default: {
+			// Unknown component types decode as zeros.
+			for (int i = 0; i < count * component_count; i++) {
+				dst[i] = T(0);
 			}
-
-			*dst++ = d;
-			src += component_size;
 		}
 	}
 
@@ -1412,11 +1408,17 @@ int GLTFDocument::_get_component_type_size(const int component_type) {
 	return 0;
 }
 
-Vector<double> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
+// Decodes the components of an accessor as T, straight into a vector of elements of type E
+// (like Vector3 for T = real_t), which must be made of a whole number of T.
+template <class E, class T>
+Vector<E> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
+	static_assert(sizeof(E) % sizeof(T) == 0, "The element type must be made of components of type T.");
+	const int components_per_element = sizeof(E) / sizeof(T);
+
 	//spec, for reference:
 	//https://github.com/KhronosGroup/glTF/tree/master/specification/2.0#data-alignment
 
-	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<double>());
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), Vector<E>());
 
 	const Ref<GLTFAccessor> a = state->accessors[p_accessor];
 
@@ -1426,7 +1428,7 @@ Vector<double> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAc
 
 	const int component_count = component_count_for_type[a->type];
 	const int component_size = _get_component_type_size(a->component_type);
-	ERR_FAIL_COND_V(component_size == 0, Vector<double>());
+	ERR_FAIL_COND_V(component_size == 0, Vector<E>());
 	int element_size = component_count * component_size;
 
 	int skip_every = 0;
@@ -1458,44 +1460,46 @@ Vector<double> GLTFDocument::_decode_accessor(Ref<GLTFState> state, const GLTFAc
 		}
 	}
 
-	Vector<double> dst_buffer;
-	dst_buffer.resize(component_count * a->count);
-	double *dst = dst_buffer.ptrw();
+	ERR_FAIL_COND_V((component_count * a->count) % components_per_element != 0, Vector<E>());
+	Vector<E> dst_buffer;
+	dst_buffer.resize(component_count * a->count / components_per_element);
+	T *dst = reinterpret_cast<T *>(dst_buffer.ptrw());
 
 	if (a->buffer_view >= 0) {
-		ERR_FAIL_INDEX_V(a->buffer_view, state->buffer_views.size(), Vector<double>());
+		ERR_FAIL_INDEX_V(a->buffer_view, state->buffer_views.size(), Vector<E>());
 
 		const Error err = _decode_buffer_view(state, dst, a->buffer_view, skip_every, skip_bytes, element_size, a->count, a->type, component_count, a->component_type, component_size, a->normalized, a->byte_offset, p_for_vertex);
 		if (err != OK) {
-			return Vector<double>();
+			return Vector<E>();
 		}
 	} else {
 		//fill with zeros, as bufferview is not defined.
 		for (int i = 0; i < (a->count * component_count); i++) {
-			dst_buffer.write[i] = 0;
+			dst[i] = T(0);
 		}
 	}
 
 	if (a->sparse_count > 0) {
 		// I could not find any file using this, so this code is so far untested
-		Vector<double> indices;
+		Vector<int> indices;
 		indices.resize(a->sparse_count);
 		const int indices_component_size = _get_component_type_size(a->sparse_indices_component_type);
 
 		Error err = _decode_buffer_view(state, indices.ptrw(), a->sparse_indices_buffer_view, 0, 0, indices_component_size, a->sparse_count, TYPE_SCALAR, 1, a->sparse_indices_component_type, indices_component_size, false, a->sparse_indices_byte_offset, false);
 		if (err != OK) {
-			return Vector<double>();
+			return Vector<E>();
 		}
 
-		Vector<double> data;
+		Vector<T> data;
 		data.resize(component_count * a->sparse_count);
 		err = _decode_buffer_view(state, data.ptrw(), a->sparse_values_buffer_view, skip_every, skip_bytes, element_size, a->sparse_count, a->type, component_count, a->component_type, component_size, a->normalized, a->sparse_values_byte_offset, p_for_vertex);
 		if (err != OK) {
-			return Vector<double>();
+			return Vector<E>();
 		}
 
 		for (int i = 0; i < indices.size(); i++) {
-			const int write_offset = int(indices[i]) * component_count;
+			const int write_offset = indices[i] * component_count;
+			ERR_FAIL_INDEX_V(write_offset, a->count * component_count, Vector<E>());
 
 			for (int j = 0; j < component_count; j++) {
 				dst[write_offset + j] = data[i * component_count + j];
@@ -1560,41 +1564,11 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_ints(Ref<GLTFState> state, c
 }
 
 Vector<int> GLTFDocument::_decode_accessor_as_ints(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<int> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size();
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = int(attribs_ptr[i]);
-		}
-	}
-	return ret;
+	return _decode_accessor<int, int>(state, p_accessor, p_for_vertex);
 }
 
 Vector<float> GLTFDocument::_decode_accessor_as_floats(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<float> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size();
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = float(attribs_ptr[i]);
-		}
-	}
-	return ret;
+	return _decode_accessor<float, float>(state, p_accessor, p_for_vertex);
 }
 
 GLTFAccessorIndex GLTFDocument::_encode_accessor_as_vec2(Ref<GLTFState> state, const Vector<Vector2> p_attribs, const bool p_for_vertex) {
@@ -1854,23 +1828,7 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_quaternions(Ref<GLTFState> s
 }
 
 Vector<Vector2> GLTFDocument::_decode_accessor_as_vec2(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<Vector2> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	ERR_FAIL_COND_V(attribs.size() % 2 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size() / 2;
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = Vector2(attribs_ptr[i * 2 + 0], attribs_ptr[i * 2 + 1]);
-		}
-	}
-	return ret;
+	return _decode_accessor<Vector2, real_t>(state, p_accessor, p_for_vertex);
 }
 
 GLTFAccessorIndex GLTFDocument::_encode_accessor_as_floats(Ref<GLTFState> state, const Vector<real_t> p_attribs, const bool p_for_vertex) {
@@ -2033,72 +1991,46 @@ GLTFAccessorIndex GLTFDocument::_encode_accessor_as_xform(Ref<GLTFState> state,
 }
 
 Vector<Vector3> GLTFDocument::_decode_accessor_as_vec3(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<Vector3> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
-	ERR_FAIL_COND_V(attribs.size() % 3 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size() / 3;
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = Vector3(attribs_ptr[i * 3 + 0], attribs_ptr[i * 3 + 1], attribs_ptr[i * 3 + 2]);
-		}
-	}
-	return ret;
+	return _decode_accessor<Vector3, real_t>(state, p_accessor, p_for_vertex);
 }
 
 Vector<Color> GLTFDocument::_decode_accessor_as_color(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
 	Vector<Color> ret;
 
-	if (attribs.size() == 0) {
-		return ret;
-	}
-
+	ERR_FAIL_INDEX_V(p_accessor, state->accessors.size(), ret);
 	const int type = state->accessors[p_accessor]->type;
 	ERR_FAIL_COND_V(!(type == TYPE_VEC3 || type == TYPE_VEC4), ret);
-	int vec_len = 3;
+
 	if (type == TYPE_VEC4) {
-		vec_len = 4;
+		return _decode_accessor<Color, float>(state, p_accessor, p_for_vertex);
+	}
+
+	const Vector<float> attribs = _decode_accessor<float, float>(state, p_accessor, p_for_vertex);
+	if (attribs.size() == 0) {
+		return ret;
 	}
 
-	ERR_FAIL_COND_V(attribs.size() % vec_len != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size() / vec_len;
+	ERR_FAIL_COND_V(attribs.size() % 3 != 0, ret);
+	const float *attribs_ptr = attribs.ptr();
+	const int ret_size = attribs.size() / 3;
 	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = Color(attribs_ptr[i * vec_len + 0], attribs_ptr[i * vec_len + 1], attribs_ptr[i * vec_len + 2], vec_len == 4 ? attribs_ptr[i * 4 + 3] : 1.0);
-		}
+	Color *ret_ptr = ret.ptrw();
+	for (int i = 0; i < ret_size; i++) {
+		ret_ptr[i] = Color(attribs_ptr[i * 3 + 0], attribs_ptr[i * 3 + 1], attribs_ptr[i * 3 + 2], 1.0);
 	}
 	return ret;
 }
 Vector<Quaternion> GLTFDocument::_decode_accessor_as_quaternion(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
-	Vector<Quaternion> ret;
-
-	if (attribs.size() == 0) {
-		return ret;
-	}
+	Vector<Quaternion> ret = _decode_accessor<Quaternion, real_t>(state, p_accessor, p_for_vertex);
 
-	ERR_FAIL_COND_V(attribs.size() % 4 != 0, ret);
-	const double *attribs_ptr = attribs.ptr();
-	const int ret_size = attribs.size() / 4;
-	ret.resize(ret_size);
-	{
-		for (int i = 0; i < ret_size; i++) {
-			ret.write[i] = Quaternion(attribs_ptr[i * 4 + 0], attribs_ptr[i * 4 + 1], attribs_ptr[i * 4 + 2], attribs_ptr[i * 4 + 3]).normalized();
-		}
+	Quaternion *ret_ptr = ret.ptrw();
+	for (int i = 0; i < ret.size(); i++) {
+		ret_ptr[i] = ret_ptr[i].normalized();
 	}
 	return ret;
 }
 Vector<Transform2D> GLTFDocument::_decode_accessor_as_xform2d(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t, real_t>(state, p_accessor, p_for_vertex);
 	Vector<Transform2D> ret;
 
 	if (attribs.size() == 0) {
@@ -2115,7 +2047,7 @@ Vector<Transform2D> GLTFDocument::_decode_accessor_as_xform2d(Ref<GLTFState> sta
 }
 
 Vector<Basis> GLTFDocument::_decode_accessor_as_basis(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t, real_t>(state, p_accessor, p_for_vertex);
 	Vector<Basis> ret;
 
 	if (attribs.size() == 0) {
@@ -2133,7 +2065,7 @@ Vector<Basis> GLTFDocument::_decode_accessor_as_basis(Ref<GLTFState> state, cons
 }
 
 Vector<Transform3D> GLTFDocument::_decode_accessor_as_xform(Ref<GLTFState> state, const GLTFAccessorIndex p_accessor, const bool p_for_vertex) {
-	const Vector<double> attribs = _decode_accessor(state, p_accessor, p_for_vertex);
+	const Vector<real_t> attribs = _decode_accessor<real_t, real_t>(state, p_accessor, p_for_vertex);
 	Vector<Transform3D> ret;
 
 	if (attribs.size() == 0) {
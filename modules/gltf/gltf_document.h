@@ -110,7 +110,8 @@ private:
 	Error _parse_buffer_views(Ref<GLTFState> state);
 	GLTFType _get_type_from_str(const String &p_string);
 	Error _parse_accessors(Ref<GLTFState> state);
-	Error _decode_buffer_view(Ref<GLTFState> state, double *dst,
+	template <class T>
+	Error _decode_buffer_view(Ref<GLTFState> state, T *dst,
 			const GLTFBufferViewIndex p_buffer_view,
 			const int skip_every, const int skip_bytes,
 			const int element_size, const int count,
@@ -118,7 +119,8 @@ private:
 			const int component_type, const int component_size,
 			const bool normalized, const int byte_offset,
 			const bool for_vertex);
-	Vector<double> _decode_accessor(Ref<GLTFState> state,
+	template <class E, class T>
+	Vector<E> _decode_accessor(Ref<GLTFState> state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
 	Vector<float> _decode_accessor_as_floats(Ref<GLTFState> state,
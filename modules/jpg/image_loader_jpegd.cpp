@@ -32,12 +32,15 @@
 
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
 
 #include <jpgd.h>
 #include <jpge.h>
 #include <string.h>
 
-Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len) {
+// When a scale below 1 is requested, scanlines are averaged in blocks of 2x2, 4x4 or 8x8 pixels while
+// decoding, the same reductions libjpeg offers with DCT scaling. The full size image is never allocated.
+Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, float p_scale = 1.0) {
 	jpgd::jpeg_decoder_mem_stream mem_stream(p_buffer, p_buffer_len);
 
 	jpgd::jpeg_decoder decoder(&mem_stream);
@@ -57,35 +60,84 @@ Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p
 		return ERR_FILE_CORRUPT;
 	}
 
-	const int dst_bpl = image_width * comps;
+	int reduction = 1;
+	if (p_scale > 0.0) {
+		while (reduction < 8 && p_scale <= 1.0 / (reduction * 2) && image_width >= reduction * 2 && image_height >= reduction * 2) {
+			reduction *= 2;
+		}
+	}
+
+	const int dst_width = (image_width + reduction - 1) / reduction;
+	const int dst_height = (image_height + reduction - 1) / reduction;
+	const int dst_bpl = dst_width * comps;
 
 	Vector<uint8_t> data;
 
-	data.resize(dst_bpl * image_height);
+	data.resize(dst_bpl * dst_height);
 
 	uint8_t *dw = data.ptrw();
 
 	jpgd::uint8 *pImage_data = (jpgd::uint8 *)dw;
 
-	for (int y = 0; y < image_height; y++) {
-		const jpgd::uint8 *pScan_line;
-		jpgd::uint scan_line_len;
-		if (decoder.decode((const void **)&pScan_line, &scan_line_len) != jpgd::JPGD_SUCCESS) {
-			return ERR_FILE_CORRUPT;
-		}
-
-		jpgd::uint8 *pDst = pImage_data + y * dst_bpl;
+	if (reduction > 1) {
+		// Sums of the source pixels falling in each destination pixel of the current destination row.
+		LocalVector<uint32_t> sums;
+		sums.resize(dst_bpl);
+		memset(sums.ptr(), 0, sizeof(uint32_t) * dst_bpl);
+		int rows_summed = 0;
+		// For images with more than 1 channel pScan_line will always point to a buffer
+		// containing 32-bit RGBA pixels. Alpha is always 255 and we ignore it.
+		const int src_pixel_size = comps == 1 ? 1 : 4;
+
+		for (int y = 0; y < image_height; y++) {
+			const jpgd::uint8 *pScan_line;
+			jpgd::uint scan_line_len;
+			if (decoder.decode((const void **)&pScan_line, &scan_line_len) != jpgd::JPGD_SUCCESS) {
+				return ERR_FILE_CORRUPT;
+			}
 
-		if (comps == 1) {
-			memcpy(pDst, pScan_line, dst_bpl);
-		} else {
-			// For images with more than 1 channel pScan_line will always point to a buffer
-			// containing 32-bit RGBA pixels. Alpha is always 255 and we ignore it.
 			for (int x = 0; x < image_width; x++) {
-				pDst[0] = pScan_line[x * 4 + 0];
-				pDst[1] = pScan_line[x * 4 + 1];
-				pDst[2] = pScan_line[x * 4 + 2];
-				pDst += 3;
+				uint32_t *sum = &sums[(x / reduction) * comps];
+				for (int c = 0; c < comps; c++) {
+					sum[c] += pScan_line[x * src_pixel_size + c];
+				}
+			}
+			rows_summed++;
+
+			if (rows_summed == reduction || y == image_height - 1) {
+				jpgd::uint8 *pDst = pImage_data + (y / reduction) * dst_bpl;
+				for (int x = 0; x < dst_width; x++) {
+					const uint32_t columns = MIN(reduction, image_width - x * reduction);
+					const uint32_t count = columns * rows_summed;
+					for (int c = 0; c < comps; c++) {
+						pDst[x * comps + c] = (sums[x * comps + c] + count / 2) / count;
+					}
+				}
+				memset(sums.ptr(), 0, sizeof(uint32_t) * dst_bpl);
+				rows_summed = 0;
+			}
+		}
+	} else {
+		for (int y = 0; y < image_height; y++) {
+			const jpgd::uint8 *pScan_line;
+			jpgd::uint scan_line_len;
+			if (decoder.decode((const void **)&pScan_line, &scan_line_len) != jpgd::JPGD_SUCCESS) {
+				return ERR_FILE_CORRUPT;
+			}
+
+			jpgd::uint8 *pDst = pImage_data + y * dst_bpl;
+
+			if (comps == 1) {
+				memcpy(pDst, pScan_line, dst_bpl);
+			} else {
+				// For images with more than 1 channel pScan_line will always point to a buffer
+				// containing 32-bit RGBA pixels. Alpha is always 255 and we ignore it.
+				for (int x = 0; x < image_width; x++) {
+					pDst[0] = pScan_line[x * 4 + 0];
+					pDst[1] = pScan_line[x * 4 + 1];
+					pDst[2] = pScan_line[x * 4 + 2];
+					pDst += 3;
+				}
 			}
 		}
 	}
@@ -99,7 +151,16 @@ Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p
 		fmt = Image::FORMAT_RGB8;
 	}
 
-	p_image->set_data(image_width, image_height, false, fmt, data);
+	p_image->set_data(dst_width, dst_height, false, fmt, data);
+
+	if (p_scale > 0.0 && p_scale < 1.0) {
+		// Reach the exact size when the requested scale isn't one of the block reductions.
+		const int target_width = MAX(1, (int)Math::round(image_width * p_scale));
+		const int target_height = MAX(1, (int)Math::round(image_height * p_scale));
+		if (target_width != dst_width || target_height != dst_height) {
+			p_image->resize(target_width, target_height, Image::INTERPOLATE_BILINEAR);
+		}
+	}
 
 	return OK;
 }
@@ -114,7 +175,7 @@ Error ImageLoaderJPG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField
 
 	f->get_buffer(&w[0], src_image_len);
 
-	Error err = jpeg_load_image_from_buffer(p_image.ptr(), w, src_image_len);
+	Error err = jpeg_load_image_from_buffer(p_image.ptr(), w, src_image_len, p_scale);
 
 	return err;
 }
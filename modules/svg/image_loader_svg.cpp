@@ -35,12 +35,24 @@
 
 #include <thorvg.h>
 
+// Upper bound for the memory used by cached rasters, the least recently used ones are dropped first.
+#define SVG_RASTER_CACHE_MAX_SIZE (16 * 1024 * 1024)
+
 HashMap<Color, Color> ImageLoaderSVG::forced_color_map = HashMap<Color, Color>();
+HashMap<ImageLoaderSVG::RasterKey, ImageLoaderSVG::Raster, ImageLoaderSVG::RasterKey> ImageLoaderSVG::raster_cache;
+uint64_t ImageLoaderSVG::raster_cache_size = 0;
+Mutex ImageLoaderSVG::raster_cache_mutex;
 
 void ImageLoaderSVG::set_forced_color_map(const HashMap<Color, Color> &p_color_map) {
 	forced_color_map = p_color_map;
 }
 
+void ImageLoaderSVG::clear_raster_cache() {
+	MutexLock lock(raster_cache_mutex);
+	raster_cache.clear();
+	raster_cache_size = 0;
+}
+
 void ImageLoaderSVG::_replace_color_property(const HashMap<Color, Color> &p_color_map, const String &p_prefix, String &r_string) {
 	// Replace colors in the SVG based on what is passed in `p_color_map`.
 	// Used to change the colors of editor icons based on the used theme.
@@ -76,6 +88,25 @@ void ImageLoaderSVG::create_image_from_string(Ref<Image> p_image, String p_strin
 		_replace_color_property(p_color_map, "stroke=\"", p_string);
 	}
 
+	RasterKey key;
+	key.source = p_string;
+	key.source_hash = p_string.hash64();
+	key.source_length = p_string.length();
+	key.scale = p_scale;
+
+	{
+		MutexLock lock(raster_cache_mutex);
+		HashMap<RasterKey, Raster, RasterKey>::Iterator E = raster_cache.find(key);
+		if (E) {
+			// Move to the back, so it's evicted last.
+			Raster raster = E->value;
+			raster_cache.remove(E);
+			raster_cache.insert(key, raster);
+			p_image->set_data(raster.width, raster.height, false, Image::FORMAT_RGBA8, raster.data);
+			return;
+		}
+	}
+
 	std::unique_ptr<tvg::Picture> picture = tvg::Picture::gen();
 	PackedByteArray bytes = p_string.to_utf8_buffer();
 
@@ -121,21 +152,39 @@ void ImageLoaderSVG::create_image_from_string(Ref<Image> p_image, String p_strin
 	Vector<uint8_t> image;
 	image.resize(width * height * sizeof(uint32_t));
 
-	for (uint32_t y = 0; y < height; y++) {
-		for (uint32_t x = 0; x < width; x++) {
-			uint32_t n = buffer[y * width + x];
-			const size_t offset = sizeof(uint32_t) * width * y + sizeof(uint32_t) * x;
-			image.write[offset + 0] = (n >> 16) & 0xff;
-			image.write[offset + 1] = (n >> 8) & 0xff;
-			image.write[offset + 2] = n & 0xff;
-			image.write[offset + 3] = (n >> 24) & 0xff;
-		}
+	uint8_t *w = image.ptrw();
+	const uint32_t pixel_count = width * height;
+	for (uint32_t i = 0; i < pixel_count; i++) {
+		uint32_t n = buffer[i];
+		w[i * 4 + 0] = (n >> 16) & 0xff;
+		w[i * 4 + 1] = (n >> 8) & 0xff;
+		w[i * 4 + 2] = n & 0xff;
+		w[i * 4 + 3] = (n >> 24) & 0xff;
 	}
 
 	res = sw_canvas->clear(true);
 	memfree(buffer);
 
 	p_image->set_data(width, height, false, Image::FORMAT_RGBA8, image);
+
+	// Large images are not worth keeping, they would push many icons out of the cache.
+	if ((uint64_t)image.size() <= SVG_RASTER_CACHE_MAX_SIZE / 4) {
+		MutexLock lock(raster_cache_mutex);
+		if (!raster_cache.has(key)) {
+			Raster raster;
+			raster.width = width;
+			raster.height = height;
+			raster.data = image;
+			raster_cache.insert(key, raster);
+			raster_cache_size += image.size() + key.source.length() * sizeof(char32_t);
+
+			while (raster_cache_size > SVG_RASTER_CACHE_MAX_SIZE) {
+				HashMap<RasterKey, Raster, RasterKey>::Iterator F = raster_cache.begin();
+				raster_cache_size -= F->value.data.size() + F->key.source.length() * sizeof(char32_t);
+				raster_cache.remove(F);
+			}
+		}
+	}
 }
 
 void ImageLoaderSVG::get_recognized_extensions(List<String> *p_extensions) const {
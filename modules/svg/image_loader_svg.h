@@ -32,14 +32,46 @@
 #define IMAGE_LOADER_SVG_H
 
 #include "core/io/image_loader.h"
+#include "core/os/mutex.h"
 
 class ImageLoaderSVG : public ImageFormatLoader {
 	static HashMap<Color, Color> forced_color_map;
 
+	// Rasterized SVGs, keyed by their source (after the color map is applied) and scale.
+	// The same icons are often generated many times at the same scale, e.g. when the editor theme is rebuilt.
+	// The source is kept in the key, as sources with the same hash must not share their raster.
+	struct RasterKey {
+		String source;
+		uint64_t source_hash = 0;
+		uint32_t source_length = 0;
+		float scale = 1.0;
+
+		bool operator==(const RasterKey &p_key) const {
+			return source_hash == p_key.source_hash && source_length == p_key.source_length && scale == p_key.scale && source == p_key.source;
+		}
+		static uint32_t hash(const RasterKey &p_key) {
+			uint32_t h = hash_murmur3_one_64(p_key.source_hash);
+			h = hash_murmur3_one_32(p_key.source_length, h);
+			h = hash_murmur3_one_float(p_key.scale, h);
+			return hash_fmix32(h);
+		}
+	};
+
+	struct Raster {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		Vector<uint8_t> data;
+	};
+
+	static HashMap<RasterKey, Raster, RasterKey> raster_cache;
+	static uint64_t raster_cache_size;
+	static Mutex raster_cache_mutex;
+
 	void _replace_color_property(const HashMap<Color, Color> &p_color_map, const String &p_prefix, String &r_string);
 
 public:
 	static void set_forced_color_map(const HashMap<Color, Color> &p_color_map);
+	static void clear_raster_cache();
 
 	void create_image_from_string(Ref<Image> p_image, String p_string, float p_scale, bool p_upsample, const HashMap<Color, Color> &p_color_map);
 
@@ -62,5 +62,6 @@ void uninitialize_svg_module(ModuleInitializationLevel p_level) {
 
 	ImageLoader::remove_image_format_loader(image_loader_svg);
 	image_loader_svg.unref();
+	ImageLoaderSVG::clear_raster_cache();
 	tvg::Initializer::term(tvg::CanvasEngine::Sw);
 }
@@ -0,0 +1,86 @@
+/*************************************************************************/
+/*  test_image_loader_svg.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_IMAGE_LOADER_SVG_H
+#define TEST_IMAGE_LOADER_SVG_H
+
+#include "modules/svg/image_loader_svg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestImageLoaderSVG {
+
+static String _rect_svg(const String &p_fill) {
+	return "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"4\" height=\"4\"><rect width=\"4\" height=\"4\" fill=\"" + p_fill + "\"/></svg>";
+}
+
+TEST_CASE("[SVG] Cached rasters") {
+	ImageLoaderSVG::clear_raster_cache();
+	ImageLoaderSVG loader;
+
+	SUBCASE("The same source is rasterized once per scale") {
+		Ref<Image> image;
+		image.instantiate();
+		loader.create_image_from_string(image, _rect_svg("#ff0000"), 1.0, false, HashMap<Color, Color>());
+		CHECK(image->get_width() == 4);
+
+		Ref<Image> cached;
+		cached.instantiate();
+		loader.create_image_from_string(cached, _rect_svg("#ff0000"), 1.0, false, HashMap<Color, Color>());
+		CHECK(cached->get_data() == image->get_data());
+
+		Ref<Image> scaled;
+		scaled.instantiate();
+		loader.create_image_from_string(scaled, _rect_svg("#ff0000"), 2.0, false, HashMap<Color, Color>());
+		CHECK(scaled->get_width() == 8);
+	}
+
+	SUBCASE("Sources with the same hash don't share their raster") {
+		// "0b" and "1A" give the same djb2 hash, so both sources have the same hash and length.
+		const String first = _rect_svg("#0b0000");
+		const String second = _rect_svg("#1A0000");
+		REQUIRE(first.hash64() == second.hash64());
+		REQUIRE(first.length() == second.length());
+
+		Ref<Image> image;
+		image.instantiate();
+		loader.create_image_from_string(image, first, 1.0, false, HashMap<Color, Color>());
+		CHECK(image->get_pixel(1, 1).get_r8() == 0x0b);
+
+		loader.create_image_from_string(image, second, 1.0, false, HashMap<Color, Color>());
+		CHECK(image->get_pixel(1, 1).get_r8() == 0x1a);
+	}
+
+	ImageLoaderSVG::clear_raster_cache();
+}
+
+} // namespace TestImageLoaderSVG
+
+#endif // TEST_IMAGE_LOADER_SVG_H
@@ -58,7 +58,7 @@ Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitFiel
 
 	f->get_buffer(&w[0], src_image_len);
 
-	Error err = WebPCommon::webp_load_image_from_buffer(p_image.ptr(), w, src_image_len);
+	Error err = WebPCommon::webp_load_image_from_buffer(p_image.ptr(), w, src_image_len, p_scale);
 
 	return err;
 }
@@ -161,7 +161,7 @@ Ref<Image> _webp_unpack(const Vector<uint8_t> &p_buffer) {
 	return img;
 }
 
-Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len) {
+Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, float p_scale) {
 	ERR_FAIL_NULL_V(p_image, ERR_INVALID_PARAMETER);
 
 	WebPBitstreamFeatures features;
@@ -169,6 +169,34 @@ Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p
 		ERR_FAIL_V(ERR_FILE_CORRUPT);
 	}
 
+	if (p_scale > 0.0 && p_scale < 1.0) {
+		// Let the decoder scale down while decoding, so the full size image is never allocated.
+		const int width = MAX(1, (int)Math::round(features.width * p_scale));
+		const int height = MAX(1, (int)Math::round(features.height * p_scale));
+		const int pixel_size = features.has_alpha ? 4 : 3;
+
+		Vector<uint8_t> dst_image;
+		dst_image.resize(width * height * pixel_size);
+
+		WebPDecoderConfig config;
+		ERR_FAIL_COND_V(!WebPInitDecoderConfig(&config), ERR_BUG);
+		config.options.use_scaling = 1;
+		config.options.scaled_width = width;
+		config.options.scaled_height = height;
+		config.output.colorspace = features.has_alpha ? MODE_RGBA : MODE_RGB;
+		config.output.is_external_memory = 1;
+		config.output.u.RGBA.rgba = dst_image.ptrw();
+		config.output.u.RGBA.stride = width * pixel_size;
+		config.output.u.RGBA.size = dst_image.size();
+
+		VP8StatusCode status = WebPDecode(p_buffer, p_buffer_len, &config);
+		WebPFreeDecBuffer(&config.output);
+		ERR_FAIL_COND_V_MSG(status != VP8_STATUS_OK, ERR_FILE_CORRUPT, "Failed decoding WebP image.");
+
+		p_image->set_data(width, height, false, features.has_alpha ? Image::FORMAT_RGBA8 : Image::FORMAT_RGB8, dst_image);
+		return OK;
+	}
+
 	Vector<uint8_t> dst_image;
 	int datasize = features.width * features.height * (features.has_alpha ? 4 : 3);
 	dst_image.resize(datasize);
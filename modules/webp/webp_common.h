@@ -39,7 +39,7 @@ Vector<uint8_t> _webp_lossy_pack(const Ref<Image> &p_image, float p_quality);
 Vector<uint8_t> _webp_lossless_pack(const Ref<Image> &p_image);
 // Given a WebP file, unpack it into an image.
 Ref<Image> _webp_unpack(const Vector<uint8_t> &p_buffer);
-Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len);
+Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, float p_scale = 1.0);
 } //namespace WebPCommon
 
 #endif // WEBP_COMMON_H
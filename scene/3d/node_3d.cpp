@@ -75,12 +75,11 @@ Node3DGizmo::Node3DGizmo() {
 
 void Node3D::_notify_dirty() {
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-
+	if (data.notify_transform && !data.ignore_notification) {
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -115,11 +114,11 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		E->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform && !data.ignore_notification) {
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL_TRANSFORM;
 
@@ -159,9 +158,7 @@ void Node3D::_notification(int p_what) {
 
 		case NOTIFICATION_EXIT_TREE: {
 			notification(NOTIFICATION_EXIT_WORLD, true);
-			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
-			}
+			get_tree()->_remove_xform_change(&xform_change);
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
 			}
@@ -824,10 +821,9 @@ bool Node3D::is_local_transform_notification_enabled() const {
 
 void Node3D::force_update_transform() {
 	ERR_FAIL_COND(!is_inside_tree());
-	if (!xform_change.in_list()) {
+	if (!get_tree()->_remove_xform_change(&xform_change)) {
 		return; //nothing to update
 	}
-	get_tree()->xform_change_list.remove(&xform_change);
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
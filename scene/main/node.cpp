@@ -46,6 +46,7 @@
 #include <stdint.h>
 
 VARIANT_ENUM_CAST(Node::ProcessMode);
+VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
 VARIANT_ENUM_CAST(Node::InternalMode);
 
 int Node::orphan_node_count = 0;
@@ -76,6 +77,12 @@ void Node::_notification(int p_notification) {
 				data.process_owner = this;
 			}
 
+			if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+				data.process_thread_group_owner = data.parent ? data.parent->data.process_thread_group_owner : nullptr;
+			} else {
+				data.process_thread_group_owner = data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD ? this : nullptr;
+			}
+
 			if (data.input) {
 				add_to_group("_vp_input" + itos(get_viewport()->get_instance_id()));
 			}
@@ -114,6 +121,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			data.process_owner = nullptr;
+			data.process_thread_group_owner = nullptr;
 			if (data.path_cache) {
 				memdelete(data.path_cache);
 				data.path_cache = nullptr;
@@ -159,6 +167,12 @@ void Node::_notification(int p_notification) {
 		} break;
 
 		case NOTIFICATION_PREDELETE: {
+			if (data.inside_tree && data.tree->processing_thread_groups) {
+				// Other groups may still be iterating over this node, so it can't go away now.
+				cancel_free();
+				ERR_FAIL_MSG("Process thread groups are being processed, free() failed. Consider using queue_free() instead.");
+			}
+
 			if (data.parent) {
 				data.parent->remove_child(this);
 			}
@@ -325,6 +339,7 @@ void Node::_propagate_exit_tree() {
 void Node::move_child(Node *p_child, int p_index) {
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
+	ERR_FAIL_COND_MSG(data.inside_tree && data.tree->processing_thread_groups, "Process thread groups are being processed, move_child() failed. Consider using call_deferred(\"move_child\", child, to_index) instead.");
 
 	// We need to check whether node is internal and move it only in the relevant node range.
 	if (p_child->_is_internal_front()) {
@@ -471,6 +486,8 @@ void Node::set_process_mode(ProcessMode p_mode) {
 		return;
 	}
 
+	ERR_FAIL_COND_MSG(get_tree()->processing_thread_groups, "Process modes can't be changed while process thread groups are being processed. Consider using call_deferred(\"set_process_mode\", mode) instead.");
+
 	bool prev_can_process = can_process();
 	bool prev_enabled = _is_enabled();
 
@@ -506,6 +523,7 @@ void Node::set_process_mode(ProcessMode p_mode) {
 	}
 
 	_propagate_process_owner(data.process_owner, pause_notification, enabled_notification);
+	get_tree()->process_version++;
 
 #ifdef TOOLS_ENABLED
 	// This is required for the editor to update the visibility of disabled nodes
@@ -554,6 +572,46 @@ void Node::_propagate_process_owner(Node *p_owner, int p_pause_notification, int
 	}
 }
 
+void Node::set_process_thread_group(ProcessThreadGroup p_group) {
+	if (data.process_thread_group == p_group) {
+		return;
+	}
+
+	if (!is_inside_tree()) {
+		data.process_thread_group = p_group;
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(get_tree()->processing_thread_groups, "Process thread groups can't be changed while they are being processed. Consider using call_deferred(\"set_process_thread_group\", group) instead.");
+
+	data.process_thread_group = p_group;
+
+	Node *owner = nullptr;
+	if (p_group == PROCESS_THREAD_GROUP_INHERIT) {
+		owner = data.parent ? data.parent->data.process_thread_group_owner : nullptr;
+	} else if (p_group == PROCESS_THREAD_GROUP_SUB_THREAD) {
+		owner = this;
+	}
+	_propagate_process_thread_group_owner(owner);
+
+	get_tree()->process_version++;
+}
+
+Node::ProcessThreadGroup Node::get_process_thread_group() const {
+	return data.process_thread_group;
+}
+
+void Node::_propagate_process_thread_group_owner(Node *p_owner) {
+	data.process_thread_group_owner = p_owner;
+
+	for (int i = 0; i < data.children.size(); i++) {
+		Node *c = data.children[i];
+		if (c->data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+			c->_propagate_process_thread_group_owner(p_owner);
+		}
+	}
+}
+
 void Node::set_multiplayer_authority(int p_peer_id, bool p_recursive) {
 	data.multiplayer_authority = p_peer_id;
 
@@ -905,6 +963,7 @@ void Node::set_name(const String &p_name) {
 	String name = p_name.validate_node_name();
 
 	ERR_FAIL_COND(name.is_empty());
+	ERR_FAIL_COND_MSG(data.inside_tree && data.tree->processing_thread_groups, "Process thread groups are being processed, set_name() failed. Consider using call_deferred(\"set_name\", name) instead.");
 
 	if (data.unique_name_in_owner && data.owner) {
 		_release_unique_name_in_owner();
@@ -1131,6 +1190,7 @@ void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_i
 	ERR_FAIL_COND_MSG(p_child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", p_child->get_name(), get_name(), p_child->get_name(), get_name()));
 #endif
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, add_node() failed. Consider using call_deferred(\"add_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.inside_tree && data.tree->processing_thread_groups, "Process thread groups are being processed, add_child() failed. Consider using call_deferred(\"add_child\", child) instead.");
 
 	_validate_child_name(p_child, p_force_readable_name);
 	_add_child_nocheck(p_child, p_child->data.name);
@@ -1166,6 +1226,7 @@ void Node::add_sibling(Node *p_sibling, bool p_force_readable_name) {
 void Node::remove_child(Node *p_child) {
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, remove_node() failed. Consider using call_deferred(\"remove_child\", child) instead.");
+	ERR_FAIL_COND_MSG(data.inside_tree && data.tree->processing_thread_groups, "Process thread groups are being processed, remove_child() failed. Consider using call_deferred(\"remove_child\", child) instead.");
 
 	int child_count = data.children.size();
 	Node **children = data.children.ptrw();
@@ -2797,6 +2858,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_processing_unhandled_key_input"), &Node::is_processing_unhandled_key_input);
 	ClassDB::bind_method(D_METHOD("set_process_mode", "mode"), &Node::set_process_mode);
 	ClassDB::bind_method(D_METHOD("get_process_mode"), &Node::get_process_mode);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
 	ClassDB::bind_method(D_METHOD("can_process"), &Node::can_process);
 	ClassDB::bind_method(D_METHOD("print_orphan_nodes"), &Node::_print_orphan_nodes);
 
@@ -2915,6 +2978,10 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PROCESS_MODE_ALWAYS);
 	BIND_ENUM_CONSTANT(PROCESS_MODE_DISABLED);
 
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+
 	BIND_ENUM_CONSTANT(DUPLICATE_SIGNALS);
 	BIND_ENUM_CONSTANT(DUPLICATE_GROUPS);
 	BIND_ENUM_CONSTANT(DUPLICATE_SCRIPTS);
@@ -2941,6 +3008,7 @@ void Node::_bind_methods() {
 	ADD_GROUP("Process", "process_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT), "set_editor_description", "get_editor_description");
@@ -53,6 +53,12 @@ public:
 		PROCESS_MODE_DISABLED, // never process
 	};
 
+	enum ProcessThreadGroup {
+		PROCESS_THREAD_GROUP_INHERIT, // same as parent node
+		PROCESS_THREAD_GROUP_MAIN_THREAD, // process on the main thread
+		PROCESS_THREAD_GROUP_SUB_THREAD, // process this subtree on a worker thread
+	};
+
 	enum DuplicateFlags {
 		DUPLICATE_SIGNALS = 1,
 		DUPLICATE_GROUPS = 2,
@@ -127,6 +133,9 @@ private:
 		ProcessMode process_mode = PROCESS_MODE_INHERIT;
 		Node *process_owner = nullptr;
 
+		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
+		Node *process_thread_group_owner = nullptr; // Root of the sub-thread group, null when processed on the main thread.
+
 		int multiplayer_authority = 1; // Server by default.
 		Variant rpc_config;
 
@@ -175,6 +184,7 @@ private:
 	void _propagate_after_exit_tree();
 	void _print_orphan_nodes();
 	void _propagate_process_owner(Node *p_owner, int p_pause_notification, int p_enabled_notification);
+	void _propagate_process_thread_group_owner(Node *p_owner);
 	void _propagate_groups_dirty();
 	Array _get_node_and_resource(const NodePath &p_path);
 
@@ -451,6 +461,9 @@ public:
 	bool can_process_notification(int p_what) const;
 	bool is_enabled() const;
 
+	void set_process_thread_group(ProcessThreadGroup p_group);
+	ProcessThreadGroup get_process_thread_group() const;
+
 	void request_ready();
 
 	static void print_orphan_nodes();
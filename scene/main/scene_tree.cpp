@@ -38,6 +38,7 @@
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
@@ -140,6 +141,8 @@ void SceneTree::node_renamed(Node *p_node) {
 }
 
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
+	_THREAD_SAFE_METHOD_ // Nodes processed in sub-thread groups may change their groups.
+
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		E = group_map.insert(p_group, Group());
@@ -149,24 +152,47 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 	E->value.nodes.push_back(p_node);
 	//E->value.last_tree_version=0;
 	E->value.changed = true;
+	E->value.process_list_dirty = true;
 	return &E->value;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
+	_THREAD_SAFE_METHOD_
+
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
 	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	_remove_from_process_list(E->value, p_node);
+	if (E->value.nodes.is_empty() && E->value.process_lock == 0) {
 		group_map.remove(E);
 	}
 }
 
 void SceneTree::make_group_changed(const StringName &p_group) {
+	_THREAD_SAFE_METHOD_
+
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (E) {
 		E->value.changed = true;
+		E->value.process_list_dirty = true;
+	}
+}
+
+void SceneTree::_add_xform_change(SelfList<Node> *p_xform_change) {
+	MutexLock lock(xform_change_mutex);
+	if (!p_xform_change->in_list()) {
+		xform_change_list.add(p_xform_change);
+	}
+}
+
+bool SceneTree::_remove_xform_change(SelfList<Node> *p_xform_change) {
+	MutexLock lock(xform_change_mutex);
+	if (!p_xform_change->in_list()) {
+		return false;
 	}
+	xform_change_list.remove(p_xform_change);
+	return true;
 }
 
 void SceneTree::flush_transform_notifications() {
@@ -818,7 +844,9 @@ void SceneTree::set_pause(bool p_enabled) {
 	if (p_enabled == paused) {
 		return;
 	}
+	ERR_FAIL_COND_MSG(processing_thread_groups, "The tree can't be paused while process thread groups are being processed. Consider using call_deferred(\"set_pause\", enable) instead.");
 	paused = p_enabled;
+	process_version++;
 	NavigationServer3D::get_singleton()->set_active(!p_enabled);
 	PhysicsServer3D::get_singleton()->set_active(!p_enabled);
 	PhysicsServer2D::get_singleton()->set_active(!p_enabled);
@@ -843,36 +871,190 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 
 	_update_group_order(g, p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 
-	//copy, so copy on write happens in case something is removed from process while being called
-	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	// The list is walked in place, so it can't be rebuilt while it's being processed.
+	// Nodes removed in the meantime leave a tombstone, and nodes added are processed from the next step on.
+	if (g.process_lock == 0 && (g.process_list_dirty || g.process_version != process_version)) {
+		_update_group_process_list(g, p_notification);
+	}
 
-	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	g.process_lock++;
 
-	call_lock++;
+	// Sub-thread groups run first, and are all done before the main thread nodes are processed.
+	if (!g.thread_group_ends.is_empty()) {
+		_process_thread_groups(g, p_notification);
+	}
+	_process_list_range(g, 0, g.main_thread_count, p_notification);
+
+	g.process_lock--;
+
+	if (g.process_lock == 0) {
+		if (g.process_tombstones) {
+			_compact_process_list(g);
+		}
+		if (g.nodes.is_empty()) {
+			// Removing the group was postponed while it was processed.
+			group_map.erase(p_group);
+		}
+	}
+}
+
+void SceneTree::_update_group_process_list(Group &g, int p_notification) {
+	g.process_list.clear();
+	g.thread_group_ends.clear();
+	g.main_thread_count = 0;
+
+	Node *const *gr_nodes = g.nodes.ptr();
+	int gr_node_count = g.nodes.size();
+	g.process_list.reserve(gr_node_count);
+
+	// Only the user callbacks run in sub-thread groups, built-in nodes are not written to process concurrently.
+	bool use_thread_groups = p_notification == Node::NOTIFICATION_PROCESS || (p_notification == Node::NOTIFICATION_PHYSICS_PROCESS && physics_thread_groups);
+
+	HashMap<Node *, uint32_t> thread_group_indices;
+	LocalVector<LocalVector<ProcessEntry>> thread_groups;
 
 	for (int i = 0; i < gr_node_count; i++) {
 		Node *n = gr_nodes[i];
-		if (call_lock && call_skip.has(n)) {
+
+		ProcessEntry entry;
+		entry.node = n;
+		entry.should_process = n->can_process() && n->can_process_notification(p_notification);
+
+		Node *owner = use_thread_groups ? n->data.process_thread_group_owner : nullptr;
+		if (!owner) {
+			g.process_list.push_back(entry);
 			continue;
 		}
 
-		if (!n->can_process()) {
+		HashMap<Node *, uint32_t>::Iterator E = thread_group_indices.find(owner);
+		if (!E) {
+			E = thread_group_indices.insert(owner, thread_groups.size());
+			thread_groups.push_back(LocalVector<ProcessEntry>());
+		}
+		thread_groups[E->value].push_back(entry);
+	}
+
+	g.main_thread_count = g.process_list.size();
+	for (uint32_t i = 0; i < thread_groups.size(); i++) {
+		for (uint32_t j = 0; j < thread_groups[i].size(); j++) {
+			g.process_list.push_back(thread_groups[i][j]);
+		}
+		g.thread_group_ends.push_back(g.process_list.size());
+	}
+
+	g.process_version = process_version;
+	g.process_list_dirty = false;
+	g.process_tombstones = false;
+}
+
+void SceneTree::_remove_from_process_list(Group &g, Node *p_node) {
+	if (g.process_list_dirty && g.process_lock == 0) {
+		return; // Rebuilt before it's used again.
+	}
+
+	for (uint32_t i = 0; i < g.process_list.size(); i++) {
+		if (g.process_list[i].node != p_node) {
 			continue;
 		}
-		if (!n->can_process_notification(p_notification)) {
+
+		if (g.process_lock > 0) {
+			g.process_list[i].node = nullptr;
+			g.process_tombstones = true;
+		} else {
+			g.process_list.remove_at(i);
+			if (i < g.main_thread_count) {
+				g.main_thread_count--;
+			}
+			for (uint32_t j = 0; j < g.thread_group_ends.size(); j++) {
+				if (g.thread_group_ends[j] > i) {
+					g.thread_group_ends[j]--;
+				}
+			}
+		}
+		return;
+	}
+}
+
+void SceneTree::_compact_process_list(Group &g) {
+	uint32_t size = g.process_list.size();
+	uint32_t removed = 0;
+
+	// Sections are the main thread nodes, then each sub-thread group.
+	uint32_t section_count = g.thread_group_ends.size() + 1;
+	uint32_t section = 0;
+
+	for (uint32_t i = 0; i <= size; i++) {
+		while (section < section_count) {
+			uint32_t &section_end = section == 0 ? g.main_thread_count : g.thread_group_ends[section - 1];
+			if (section_end != i) {
+				break;
+			}
+			section_end -= removed;
+			section++;
+		}
+
+		if (i == size) {
+			break;
+		}
+
+		if (g.process_list[i].node == nullptr) {
+			removed++;
+		} else if (removed > 0) {
+			g.process_list[i - removed] = g.process_list[i];
+		}
+	}
+
+	g.process_list.resize(size - removed);
+	g.process_tombstones = false;
+}
+
+void SceneTree::_process_list_range(const Group &g, uint32_t p_from, uint32_t p_to, int p_notification) {
+	const ProcessEntry *entries = g.process_list.ptr();
+	for (uint32_t i = p_from; i < p_to; i++) {
+		Node *n = entries[i].node;
+		if (!n) {
+			continue; // Removed while processing.
+		}
+
+		if (likely(g.process_version == process_version)) {
+			if (!entries[i].should_process) {
+				continue;
+			}
+		} else if (!n->can_process() || !n->can_process_notification(p_notification)) {
+			// The tree was paused or a process mode changed during this step.
 			continue;
 		}
 
 		n->notification(p_notification);
-		//ERR_FAIL_COND(gr_node_count != g.nodes.size());
 	}
+}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
+void SceneTree::_process_thread_groups(Group &g, int p_notification) {
+	ThreadGroupProcess process;
+	process.group = &g;
+	process.notification = p_notification;
+
+	// Changing the tree from here on has to be deferred, so it is the same whether the groups run on threads or not.
+	processing_thread_groups = true;
+
+	uint32_t thread_group_count = g.thread_group_ends.size();
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+	if (thread_group_count > 1 && thread_pool && thread_pool->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group_task = thread_pool->add_template_group_task(this, &SceneTree::_process_thread_group, &process, thread_group_count, -1, true, SNAME("SceneTreeProcessGroups"));
+		thread_pool->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < thread_group_count; i++) {
+			_process_thread_group(i, &process);
+		}
 	}
+
+	processing_thread_groups = false;
+}
+
+void SceneTree::_process_thread_group(uint32_t p_index, ThreadGroupProcess *p_process) {
+	const Group &g = *p_process->group;
+	uint32_t from = p_index == 0 ? g.main_thread_count : g.thread_group_ends[p_index - 1];
+	_process_list_range(g, from, g.thread_group_ends[p_index], p_process->notification);
 }
 
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
@@ -1379,6 +1561,10 @@ SceneTree::SceneTree() {
 	debug_paths_color = GLOBAL_DEF("debug/shapes/paths/geometry_color", Color(0.1, 1.0, 0.7, 0.4));
 	debug_paths_width = GLOBAL_DEF("debug/shapes/paths/geometry_width", 2.0);
 	collision_debug_contacts = GLOBAL_DEF("debug/shapes/collision/max_contacts_displayed", 10000);
+
+	// Physics servers queue calls from other threads only when they run on their own thread, otherwise
+	// physics process callbacks stay on the main thread.
+	physics_thread_groups = GLOBAL_GET("physics/2d/run_on_separate_thread") && GLOBAL_GET("physics/3d/run_on_separate_thread");
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/shapes/collision/max_contacts_displayed", PropertyInfo(Variant::INT, "debug/shapes/collision/max_contacts_displayed", PROPERTY_HINT_RANGE, "0,20000,1")); // No negative
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
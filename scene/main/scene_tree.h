@@ -33,6 +33,7 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 
@@ -86,9 +87,29 @@ public:
 	typedef void (*IdleCallback)();
 
 private:
+	struct ProcessEntry {
+		Node *node = nullptr; // Null when removed while the list is being processed.
+		bool should_process = false;
+	};
+
 	struct Group {
 		Vector<Node *> nodes;
 		bool changed = false;
+
+		// Nodes in processing order: the main thread nodes, then each sub-thread group.
+		// Removed nodes are erased in place, other changes rebuild the list before the next processing step.
+		LocalVector<ProcessEntry> process_list;
+		LocalVector<uint32_t> thread_group_ends; // End of each sub-thread group in `process_list`.
+		uint32_t main_thread_count = 0;
+		uint64_t process_version = 0; // The `should_process` flags are valid while this matches the tree's.
+		bool process_list_dirty = true;
+		bool process_tombstones = false;
+		int process_lock = 0;
+	};
+
+	struct ThreadGroupProcess {
+		Group *group = nullptr;
+		int notification = 0;
 	};
 
 	Window *root = nullptr;
@@ -137,6 +158,10 @@ private:
 	int call_lock = 0;
 	HashSet<Node *> call_skip; // Skip erased nodes.
 
+	uint64_t process_version = 1; // Bumped when nodes may start or stop being able to process. Never changed while thread groups are processed.
+	bool processing_thread_groups = false;
+	bool physics_thread_groups = false; // Only when the physics servers take calls from any thread.
+
 	List<ObjectID> delete_queue;
 
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
@@ -188,6 +213,12 @@ private:
 	void make_group_changed(const StringName &p_group);
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+	void _update_group_process_list(Group &g, int p_notification);
+	void _remove_from_process_list(Group &g, Node *p_node);
+	void _compact_process_list(Group &g);
+	_FORCE_INLINE_ void _process_list_range(const Group &g, uint32_t p_from, uint32_t p_to, int p_notification);
+	void _process_thread_groups(Group &g, int p_notification);
+	void _process_thread_group(uint32_t p_index, ThreadGroupProcess *p_process);
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -197,7 +228,11 @@ private:
 	friend class Node3D;
 	friend class Viewport;
 
+	// Nodes of process thread groups can change their transform concurrently, so the list has its own lock.
 	SelfList<Node>::List xform_change_list;
+	BinaryMutex xform_change_mutex;
+	void _add_xform_change(SelfList<Node> *p_xform_change);
+	bool _remove_xform_change(SelfList<Node> *p_xform_change);
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -41,6 +41,7 @@
 #include "scene/gui/control.h"
 #include "scene/main/instance_placeholder.h"
 #include "scene/main/missing_node.h"
+#include "scene/main/scene_tree.h"
 #include "scene/property_utils.h"
 
 #define PACKED_SCENE_VERSION 2
@@ -70,6 +71,83 @@ static Array _sanitize_node_pinned_properties(Node *p_node) {
 	return pinned;
 }
 
+// Equivalent to Object::set() for a property whose setter was resolved in advance, valid as long
+// as the object has no script instance that could intercept the property first.
+static void _set_property_with_setter(Object *p_object, MethodBind *p_setter, int p_index, const Variant &p_value) {
+#ifdef TOOLS_ENABLED
+	if (!p_object->is_edited()) {
+		p_object->set_edited(true);
+	}
+#endif
+
+	Callable::CallError ce;
+	if (p_index >= 0) {
+		Variant index = p_index;
+		const Variant *args[2] = { &index, &p_value };
+		p_setter->call(p_object, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		p_setter->call(p_object, args, 1, ce);
+	}
+}
+
+void SceneState::_build_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_valid.is_set()) {
+		return; // Another thread built it while we were waiting.
+	}
+
+	int nc = nodes.size();
+	instantiation_plan.nodes.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::NodePlan &np = instantiation_plan.nodes[i];
+		np.creation_func = nullptr;
+		np.setters.clear();
+		np.setter_indices.clear();
+
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANCED) {
+			continue; // Not created by this scene, the class is unknown until instantiated.
+		}
+		if (n.type < 0 || n.type >= names.size()) {
+			continue; // Let instantiate() report the error.
+		}
+
+		StringName created_class;
+		np.creation_func = ClassDB::get_native_creation_func(names[n.type], &created_class);
+		if (!np.creation_func) {
+			continue;
+		}
+
+		int nprop_count = n.properties.size();
+		np.setters.resize(nprop_count);
+		np.setter_indices.resize(nprop_count);
+		for (int j = 0; j < nprop_count; j++) {
+			const NodeData::Property &prop = n.properties[j];
+			np.setters[j] = nullptr;
+			np.setter_indices[j] = -1;
+
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE || prop.name < 0 || prop.name >= names.size()) {
+				continue;
+			}
+			if (names[prop.name] == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+
+			np.setters[j] = ClassDB::get_property_setter_method(created_class, names[prop.name], &np.setter_indices[j]);
+		}
+	}
+
+	instantiation_plan_valid.set();
+}
+
+void SceneState::_invalidate_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_valid.clear();
+	instantiation_plan.nodes.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// nodes where instancing failed (because something is missing)
 	List<Node *> stray_instances;
@@ -99,7 +177,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		props = &variants[0];
 	}
 
-	//Vector<Variant> properties;
+	if (!instantiation_plan_valid.is_set()) {
+		_build_instantiation_plan();
+	}
+	const InstantiationPlan::NodePlan *node_plans = instantiation_plan.nodes.ptr();
 
 	const NodeData *nd = &nodes[0];
 
@@ -136,6 +217,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
+		const InstantiationPlan::NodePlan *node_plan = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -181,11 +263,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (node_plans[i].creation_func) {
+				obj = node_plans[i].creation_func();
+				node_plan = &node_plans[i];
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
 
 			if (!node) {
+				node_plan = nullptr;
 				if (obj) {
 					memdelete(obj);
 					obj = nullptr;
@@ -328,7 +417,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							MethodBind *setter = (node_plan && !node->get_script_instance()) ? node_plan->setters[j] : nullptr;
+							if (setter) {
+								_set_property_with_setter(node, setter, node_plan->setter_indices[j], value);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -471,6 +565,242 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+bool SceneState::_reset_node_to_defaults(Node *p_node, const NodeData &p_node_data) const {
+	// Properties stored in the scene are applied by the caller, the rest go back to
+	// the defaults of the script (if any) or the native class.
+	Ref<Script> scr = p_node->get_script();
+	const StringName *snames = names.ptr();
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE)) {
+			continue;
+		}
+
+		bool stored = false;
+		for (int i = 0; i < p_node_data.properties.size(); i++) {
+			int name_idx = p_node_data.properties[i].name & FLAG_PROP_NAME_MASK;
+			if (name_idx < names.size() && snames[name_idx] == E.name) {
+				stored = true;
+				break;
+			}
+		}
+		if (stored) {
+			continue;
+		}
+
+		if (E.name == CoreStringNames::get_singleton()->_script) {
+			if (scr.is_valid()) {
+				return false; // A script was attached after instantiation, can't be undone.
+			}
+			continue;
+		}
+
+		bool valid = false;
+		Variant default_value;
+		if (scr.is_valid()) {
+			valid = scr->get_property_default_value(E.name, default_value);
+		}
+		if (!valid) {
+			default_value = ClassDB::class_get_default_property_value(p_node->get_class_name(), E.name, &valid);
+		}
+		if (valid && PropertyUtils::is_property_value_different(p_node->get(E.name), default_value)) {
+			p_node->set(E.name, default_value);
+		}
+	}
+
+	return true;
+}
+
+// Brings a node hierarchy previously created by instantiate() back to the packed state, only
+// setting the properties whose value differs from it. Returns false if the hierarchy was
+// modified in a way that can't be reverted, such as nodes being added, removed or renamed,
+// their script or groups changing, or signals being connected to nodes outside of it.
+bool SceneState::reset_instance(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, false);
+	ERR_FAIL_COND_V(nodes.size() == 0, false);
+	ERR_FAIL_INDEX_V(nodes[0].name, names.size(), false);
+
+	ResetInstanceState state;
+	if (!_reset_instance(p_root, state)) {
+		return false;
+	}
+
+	int connection_count = 0;
+	if (!_is_instance_unmodified(p_root, p_root, state, connection_count) || connection_count != state.connection_count) {
+		return false;
+	}
+
+	// The root gets renamed when added next to a sibling with the same name, which is harmless to undo.
+	if (p_root->get_name() != names[nodes[0].name]) {
+		p_root->set_name(names[nodes[0].name]);
+	}
+
+	return true;
+}
+
+bool SceneState::_reset_instance(Node *p_root, ResetInstanceState &r_state) const {
+	int nc = nodes.size();
+	ERR_FAIL_COND_V(nc == 0, false);
+	r_state.connection_count += connections.size();
+
+	const StringName *snames = names.ptr();
+	const Variant *props = variants.ptr();
+	int sname_count = names.size();
+	int prop_count = variants.size();
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+	LocalVector<DeferredNodePathProperties> deferred_node_paths;
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+
+		Node *node = nullptr;
+		if (i == 0) {
+			node = p_root;
+		} else {
+			Node *parent = nullptr;
+			if (n.parent & FLAG_ID_IS_PATH) {
+				parent = p_root->get_node_or_null(node_paths[n.parent & FLAG_MASK]);
+			} else if (n.parent >= 0 && n.parent < i) {
+				parent = ret_nodes[n.parent];
+			}
+			ERR_FAIL_INDEX_V(n.name, sname_count, false);
+			node = parent ? parent->_get_child_by_name(snames[n.name]) : nullptr;
+		}
+		if (!node) {
+			return false;
+		}
+		ret_nodes[i] = node;
+
+		HashSet<StringName> &node_groups = r_state.node_groups[node];
+		for (int j = 0; j < n.groups.size(); j++) {
+			ERR_FAIL_INDEX_V(n.groups[j], sname_count, false);
+			node_groups.insert(snames[n.groups[j]]);
+		}
+
+		if (i == 0 && base_scene_idx >= 0) {
+			Ref<PackedScene> sdata = props[base_scene_idx];
+			if (sdata.is_null() || !sdata->get_state()->_reset_instance(node, r_state)) {
+				return false;
+			}
+		} else if (n.instance >= 0) {
+			if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) {
+				return false; // May have been replaced by the actual scene.
+			}
+			Ref<PackedScene> sdata = props[n.instance & FLAG_MASK];
+			if (sdata.is_null() || !sdata->get_state()->_reset_instance(node, r_state)) {
+				return false;
+			}
+		} else if (n.type != TYPE_INSTANCED) {
+			if (!_reset_node_to_defaults(node, n)) {
+				return false;
+			}
+		}
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			ERR_FAIL_INDEX_V(prop.value, prop_count, false);
+			ERR_FAIL_INDEX_V(prop.name & FLAG_PROP_NAME_MASK, sname_count, false);
+			const StringName &pname = snames[prop.name & FLAG_PROP_NAME_MASK];
+			const Variant &value = props[prop.value];
+
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				if (!Engine::get_singleton()->is_editor_hint()) {
+					DeferredNodePathProperties dnp;
+					dnp.path = value;
+					dnp.base = node;
+					dnp.property = pname;
+					deferred_node_paths.push_back(dnp);
+				}
+				continue;
+			}
+
+			if (pname == CoreStringNames::get_singleton()->_script) {
+				if (node->get_script() != value) {
+					return false;
+				}
+				continue;
+			}
+
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					continue; // The instance keeps its own copy.
+				}
+			}
+
+			if (PropertyUtils::is_property_value_different(node->get(pname), value)) {
+				node->set(pname, value);
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < deferred_node_paths.size(); i++) {
+		const DeferredNodePathProperties &dnp = deferred_node_paths[i];
+		Node *other = dnp.base->get_node_or_null(dnp.path);
+		if (dnp.base->get(dnp.property) != Variant(other)) {
+			dnp.base->set(dnp.property, other);
+		}
+	}
+
+	return true;
+}
+
+// Checks the nodes below p_node against what the reset scenes expect, counting the persistent
+// connections so the caller can tell whether any were added. Internal children are created by
+// their parent, so they are not part of the scene and are skipped.
+bool SceneState::_is_instance_unmodified(Node *p_root, Node *p_node, const ResetInstanceState &p_state, int &r_connection_count) const {
+	HashMap<Node *, HashSet<StringName>>::ConstIterator E = p_state.node_groups.find(p_node);
+	if (!E) {
+		return false; // Added after instantiation.
+	}
+
+	List<Node::GroupInfo> groups;
+	p_node->get_groups(&groups);
+	if (groups.size() != E->value.size()) {
+		return false;
+	}
+	for (const Node::GroupInfo &gi : groups) {
+		if (!E->value.has(gi.name)) {
+			return false;
+		}
+	}
+
+	// Connections to nodes outside of the instance were made by whoever used it and would
+	// still be there when it's reused. Resources and other objects are fine, as nodes
+	// connect to the resources they use on their own.
+	List<Connection> connections_from;
+	p_node->get_all_signal_connections(&connections_from);
+	for (const Connection &c : connections_from) {
+		Node *target = Object::cast_to<Node>(c.callable.get_object());
+		if (target && target != p_root && !p_root->is_ancestor_of(target)) {
+			return false;
+		}
+		if (c.flags & CONNECT_PERSIST) {
+			r_connection_count++;
+		}
+	}
+
+	List<Connection> connections_to;
+	p_node->get_signals_connected_to_this(&connections_to);
+	for (const Connection &c : connections_to) {
+		Node *source = Object::cast_to<Node>(c.signal.get_object());
+		if (source && source != p_root && !p_root->is_ancestor_of(source)) {
+			return false;
+		}
+	}
+
+	for (int i = 0; i < p_node->get_child_count(false); i++) {
+		if (!_is_instance_unmodified(p_root, p_node->get_child(i, false), p_state, r_connection_count)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static int _nm_get_string(const String &p_string, HashMap<StringName, int> &name_map) {
 	if (name_map.has(p_string)) {
 		return name_map[p_string];
@@ -995,6 +1325,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_invalidate_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1191,6 +1522,7 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 		variants.clear();
 	}
 
+	_invalidate_instantiation_plan();
 	nodes.resize(node_count);
 	if (node_count) {
 		const int *r = snodes.ptr();
@@ -1618,6 +1950,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_invalidate_instantiation_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1634,6 +1967,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_invalidate_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1645,6 +1979,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_invalidate_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -1722,6 +2057,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_instance_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -1730,10 +2066,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_instance_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_instance_pool();
 	state->clear();
 }
 
@@ -1764,7 +2102,150 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_many(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+#ifndef TOOLS_ENABLED
+	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, TypedArray<Node>(), "Edit state is only for editors, does not work without tools compiled.");
+#endif
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+
+	String scene_file_path = is_built_in() ? String() : get_path();
+	for (int i = 0; i < p_count; i++) {
+		Node *s = state->instantiate((SceneState::GenEditState)p_edit_state);
+		if (!s) {
+			ret.resize(i);
+			ERR_FAIL_V_MSG(ret, vformat("Failed to instantiate scene, only %d of %d instances were created.", i, p_count));
+		}
+
+		if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
+			s->set_scene_instance_state(state);
+		}
+
+		if (!scene_file_path.is_empty()) {
+			s->set_scene_file_path(scene_file_path);
+		}
+
+		s->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+
+		ret[i] = s;
+	}
+
+	return ret;
+}
+
+// Returns an instance taken from the pool when one is available, or a new one otherwise.
+// Pooled instances are already in the packed state and don't receive _ready() again.
+Node *PackedScene::instantiate_pooled() {
+	{
+		MutexLock lock(instance_pool_mutex);
+		while (instance_pool.size()) {
+			PooledInstance pooled = instance_pool[instance_pool.size() - 1];
+			instance_pool.resize(instance_pool.size() - 1);
+			pooled_instance_count.decrement();
+			pooled_node_count.sub(pooled.node_count);
+
+			Node *node = Object::cast_to<Node>(ObjectDB::get_instance(pooled.id));
+			if (node) {
+				instance_pool_hits.increment();
+				return node;
+			}
+		}
+	}
+
+	instance_pool_misses.increment();
+	return instantiate();
+}
+
+static uint32_t _count_nodes(const Node *p_node) {
+	uint32_t count = 1;
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		count += _count_nodes(p_node->get_child(i));
+	}
+	return count;
+}
+
+static void _free_released_instance(Node *p_instance) {
+	// Deferred because this is likely to be called by a script attached to the instance itself.
+	if (SceneTree::get_singleton()) {
+		p_instance->queue_free();
+	} else {
+		memdelete(p_instance);
+	}
+}
+
+// Takes an instance of this scene out of the tree and keeps it for a later instantiate_pooled() call
+// instead of freeing it. Instances that can't be brought back to the packed state are freed.
+void PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(!is_built_in() && p_instance->get_scene_file_path() != get_path(), "The node being released is not an instance of this scene.");
+
+	// Held for the whole release, so that concurrent releases can't go over the maximum size.
+	MutexLock lock(instance_pool_mutex);
+	const ObjectID id = p_instance->get_instance_id();
+	for (uint32_t i = 0; i < instance_pool.size(); i++) {
+		ERR_FAIL_COND_MSG(instance_pool[i].id == id, "The node being released is already in the instance pool.");
+	}
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	if ((int)instance_pool.size() >= instance_pool_max_size || !state->reset_instance(p_instance)) {
+		_free_released_instance(p_instance);
+		return;
+	}
+
+	PooledInstance pooled;
+	pooled.id = id;
+	pooled.node_count = _count_nodes(p_instance);
+	instance_pool.push_back(pooled);
+	pooled_instance_count.increment();
+	pooled_node_count.add(pooled.node_count);
+}
+
+void PackedScene::clear_instance_pool() {
+	MutexLock lock(instance_pool_mutex);
+	for (uint32_t i = 0; i < instance_pool.size(); i++) {
+		const PooledInstance &pooled = instance_pool[i];
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(pooled.id));
+		if (node) {
+			memdelete(node);
+		}
+		pooled_instance_count.decrement();
+		pooled_node_count.sub(pooled.node_count);
+	}
+	instance_pool.clear();
+}
+
+void PackedScene::set_instance_pool_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	MutexLock lock(instance_pool_mutex);
+	instance_pool_max_size = p_max_size;
+	while ((int)instance_pool.size() > instance_pool_max_size) {
+		const PooledInstance &pooled = instance_pool[instance_pool.size() - 1];
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(pooled.id));
+		if (node) {
+			memdelete(node);
+		}
+		pooled_instance_count.decrement();
+		pooled_node_count.sub(pooled.node_count);
+		instance_pool.resize(instance_pool.size() - 1);
+	}
+}
+
+int PackedScene::get_instance_pool_max_size() const {
+	return instance_pool_max_size;
+}
+
+int PackedScene::get_instance_pool_size() const {
+	MutexLock lock(instance_pool_mutex);
+	return instance_pool.size();
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_instance_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1773,6 +2254,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_instance_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1795,7 +2277,14 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_many", "count", "edit_state"), &PackedScene::instantiate_many, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
+	ClassDB::bind_method(D_METHOD("set_instance_pool_max_size", "max_size"), &PackedScene::set_instance_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_instance_pool_max_size"), &PackedScene::get_instance_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_instance_pool_size"), &PackedScene::get_instance_pool_size);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -1808,6 +2297,15 @@ void PackedScene::_bind_methods() {
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_MAIN_INHERITED);
 }
 
+SafeNumeric<uint64_t> PackedScene::instance_pool_hits;
+SafeNumeric<uint64_t> PackedScene::instance_pool_misses;
+SafeNumeric<uint64_t> PackedScene::pooled_instance_count;
+SafeNumeric<uint64_t> PackedScene::pooled_node_count;
+
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
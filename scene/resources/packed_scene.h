@@ -32,6 +32,10 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/typed_array.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +93,25 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Constructors and property setters resolved once per scene, so instantiating it
+	// doesn't have to go through ClassDB and Object::set() lookups by name every time.
+	struct InstantiationPlan {
+		struct NodePlan {
+			ClassDB::NativeCreationFunc creation_func = nullptr; // nullptr if the node isn't created through ClassDB directly.
+			LocalVector<MethodBind *> setters; // One per NodeData::Property, nullptr if it must go through Object::set().
+			LocalVector<int> setter_indices;
+		};
+
+		LocalVector<NodePlan> nodes;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_valid;
+	mutable Mutex instantiation_plan_mutex;
+
+	void _build_instantiation_plan() const;
+	void _invalidate_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -100,6 +123,17 @@ class SceneState : public RefCounted {
 
 	Vector<String> _get_node_groups(int p_idx) const;
 
+	// What the nodes of a reset instance are expected to look like, gathered over the
+	// scene and all the scenes instantiated inside of it.
+	struct ResetInstanceState {
+		HashMap<Node *, HashSet<StringName>> node_groups;
+		int connection_count = 0;
+	};
+
+	bool _reset_node_to_defaults(Node *p_node, const NodeData &p_node_data) const;
+	bool _reset_instance(Node *p_root, ResetInstanceState &r_state) const;
+	bool _is_instance_unmodified(Node *p_root, Node *p_node, const ResetInstanceState &p_state, int &r_connection_count) const;
+
 	int _find_base_scene_node_remap_key(int p_idx) const;
 
 protected:
@@ -146,6 +180,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_root) const;
 
 	Ref<SceneState> get_base_scene_state() const;
 
@@ -209,6 +244,20 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	struct PooledInstance {
+		ObjectID id;
+		uint32_t node_count = 0;
+	};
+
+	LocalVector<PooledInstance> instance_pool;
+	int instance_pool_max_size = 32;
+	mutable Mutex instance_pool_mutex;
+
+	static SafeNumeric<uint64_t> instance_pool_hits;
+	static SafeNumeric<uint64_t> instance_pool_misses;
+	static SafeNumeric<uint64_t> pooled_instance_count;
+	static SafeNumeric<uint64_t> pooled_node_count;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -231,6 +280,19 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_many(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+
+	Node *instantiate_pooled();
+	void release_instance(Node *p_instance);
+	void clear_instance_pool();
+	void set_instance_pool_max_size(int p_max_size);
+	int get_instance_pool_max_size() const;
+	int get_instance_pool_size() const;
+
+	static uint64_t get_instance_pool_hit_count() { return instance_pool_hits.get(); }
+	static uint64_t get_instance_pool_miss_count() { return instance_pool_misses.get(); }
+	static uint64_t get_pooled_instance_count() { return pooled_instance_count.get(); }
+	static uint64_t get_pooled_node_count() { return pooled_node_count.get(); }
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -245,6 +307,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -30,6 +30,8 @@
 
 #include "texture.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/io/image_loader.h"
 #include "core/io/marshalls.h"
@@ -661,7 +663,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -734,7 +736,8 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			// Leading mipmaps may have been skipped due to the size limit, so the image starts at the first one read.
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -745,11 +748,11 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
-				continue; //oops, size limit enforced, go to next
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
+				// Too large, skip to the next mipmap.
+				int next_ofs = Image::get_image_mipmap_offset(w, h, format, i + 1);
+				f->seek(f->get_position() + next_ofs - ofs);
+				continue;
 			}
 
 			Vector<uint8_t> data;
@@ -862,6 +865,165 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	return OK;
 }
 
+// Size of the header preceding the image data in .ctex files.
+#define CTEX_HEADER_SIZE 36
+
+Mutex CompressedTexture2D::streaming_mutex;
+SelfList<CompressedTexture2D>::List CompressedTexture2D::streaming_resident;
+uint64_t CompressedTexture2D::streaming_resident_size = 0;
+
+void CompressedTexture2D::_streaming_request() const {
+	streaming_last_used.set(Engine::get_singleton()->get_process_frames());
+	if (streaming_state.get() != STREAMING_LOW) {
+		return;
+	}
+
+	MutexLock lock(streaming_mutex);
+	if (streaming_state.get() == STREAMING_LOW) {
+		_streaming_start_load();
+	}
+}
+
+void CompressedTexture2D::_streaming_pin() const {
+	// Uses through the RID (materials, meshes, polygons, 3D) are not tracked, so the texture
+	// is loaded in full and kept out of the budget from then on.
+	MutexLock lock(streaming_mutex);
+	streaming_pinned = true;
+	switch (streaming_state.get()) {
+		case STREAMING_LOW: {
+			_streaming_start_load();
+		} break;
+		case STREAMING_FULL: {
+			CompressedTexture2D *self = const_cast<CompressedTexture2D *>(this);
+			streaming_resident.remove(&self->streaming_resident_element);
+			streaming_resident_size -= streaming_full_size;
+			self->streaming_full_size = 0;
+			streaming_state.set(STREAMING_DISABLED);
+		} break;
+		default: {
+			// Pending textures are pinned once loaded.
+		} break;
+	}
+}
+
+void CompressedTexture2D::_streaming_start_load() const {
+	streaming_state.set(STREAMING_PENDING);
+
+	StreamingTask *task = memnew(StreamingTask);
+	task->texture = Ref<CompressedTexture2D>(const_cast<CompressedTexture2D *>(this));
+	task->path = path_to_file;
+	task->generation = streaming_generation;
+	streaming_task_id = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_streaming_load_task, task, false, "StreamTexture");
+}
+
+void CompressedTexture2D::_streaming_load_task(void *p_userdata) {
+	StreamingTask *task = (StreamingTask *)p_userdata;
+
+	Ref<Image> image;
+	Ref<FileAccess> f = FileAccess::open(task->path, FileAccess::READ);
+	if (f.is_valid()) {
+		f->seek(CTEX_HEADER_SIZE);
+		image = load_image_from_file(f, 0);
+	}
+
+	// The texture is applied from the main thread, which also reclaims the task.
+	callable_mp_static(&CompressedTexture2D::_streaming_finished).call_deferred(task->texture, image, task->generation);
+	memdelete(task);
+}
+
+void CompressedTexture2D::_streaming_finished(Ref<CompressedTexture2D> p_texture, Ref<Image> p_image, uint32_t p_generation) {
+	CompressedTexture2D *tex = p_texture.ptr();
+
+	MutexLock lock(streaming_mutex);
+	if (tex->streaming_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tex->streaming_task_id);
+		tex->streaming_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	if (p_generation != tex->streaming_generation || tex->streaming_state.get() != STREAMING_PENDING) {
+		return; // Reloaded in the meantime.
+	}
+
+	if (p_image.is_null() || p_image->is_empty()) {
+		tex->streaming_state.set(STREAMING_DISABLED);
+		ERR_FAIL_MSG("Unable to stream texture: " + tex->path_to_file + ".");
+	}
+
+	RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+	RS::get_singleton()->texture_replace(tex->texture, new_texture);
+
+	if (tex->streaming_pinned) {
+		tex->streaming_state.set(STREAMING_DISABLED);
+		return;
+	}
+
+	tex->streaming_state.set(STREAMING_FULL);
+	tex->streaming_full_size = p_image->get_data().size();
+	streaming_resident.add(&tex->streaming_resident_element);
+	streaming_resident_size += tex->streaming_full_size;
+
+	streaming_fit_budget(uint64_t(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb")) * 1024 * 1024, Engine::get_singleton()->get_process_frames());
+}
+
+void CompressedTexture2D::streaming_fit_budget(uint64_t p_budget, uint64_t p_frame) {
+	MutexLock lock(streaming_mutex);
+	if (streaming_resident_size <= p_budget) {
+		return;
+	}
+
+	struct LastUsedComparator {
+		_FORCE_INLINE_ bool operator()(const CompressedTexture2D *p_a, const CompressedTexture2D *p_b) const {
+			return p_a->streaming_last_used.get() < p_b->streaming_last_used.get();
+		}
+	};
+
+	// Go back to the small mipmaps for the least recently used textures until the budget is met.
+	// Textures used during the current frame are kept, even if that means going over the budget.
+	LocalVector<CompressedTexture2D *> candidates;
+	for (SelfList<CompressedTexture2D> *E = streaming_resident.first(); E; E = E->next()) {
+		if (E->self()->streaming_last_used.get() < p_frame) {
+			candidates.push_back(E->self());
+		}
+	}
+	candidates.sort_custom<LastUsedComparator>();
+
+	for (uint32_t i = 0; i < candidates.size() && streaming_resident_size > p_budget; i++) {
+		candidates[i]->_streaming_evict();
+	}
+}
+
+uint64_t CompressedTexture2D::get_streaming_resident_size() {
+	MutexLock lock(streaming_mutex);
+	return streaming_resident_size;
+}
+
+void CompressedTexture2D::_streaming_evict() {
+	RID new_texture = RS::get_singleton()->texture_2d_create(streaming_low_image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(texture, w, h);
+
+	streaming_resident.remove(&streaming_resident_element);
+	streaming_resident_size -= streaming_full_size;
+	streaming_full_size = 0;
+	streaming_state.set(STREAMING_LOW);
+}
+
+void CompressedTexture2D::_streaming_reset(const Ref<Image> &p_low_image) {
+	MutexLock lock(streaming_mutex);
+	if (streaming_state.get() == STREAMING_PENDING && streaming_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(streaming_task_id);
+		streaming_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	if (streaming_resident_element.in_list()) {
+		streaming_resident.remove(&streaming_resident_element);
+		streaming_resident_size -= streaming_full_size;
+	}
+	streaming_full_size = 0;
+	streaming_generation++;
+	streaming_low_image = p_low_image;
+	streaming_state.set(p_low_image.is_valid() ? STREAMING_LOW : STREAMING_DISABLED);
+}
+
 Error CompressedTexture2D::load(const String &p_path) {
 	int lw, lh;
 	Ref<Image> image;
@@ -872,11 +1034,20 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	int size_limit = 0;
+	if (GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		size_limit = GLOBAL_GET("rendering/textures/streaming/initial_size");
+	}
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit);
 	if (err) {
 		return err;
 	}
 
+	// Only the small mipmaps were loaded if the file is streamed, the rest is loaded once the texture is used.
+	const bool streamed = size_limit > 0 && (image->get_width() < lw || image->get_height() < lh);
+	_streaming_reset(streamed ? image : Ref<Image>());
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
@@ -890,6 +1061,10 @@ Error CompressedTexture2D::load(const String &p_path) {
 	w = lw;
 	h = lh;
 	path_to_file = p_path;
+
+	if (streamed && streaming_pinned) {
+		_streaming_pin(); // Already used through the RID, load the full image again.
+	}
 	format = image->get_format();
 
 	if (get_path().is_empty()) {
@@ -945,6 +1120,9 @@ RID CompressedTexture2D::get_rid() const {
 	if (!texture.is_valid()) {
 		texture = RS::get_singleton()->texture_2d_placeholder_create();
 	}
+	if (streaming_state.get() != STREAMING_DISABLED) {
+		_streaming_pin();
+	}
 	return texture;
 }
 
@@ -952,6 +1130,7 @@ void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Col
 	if ((w | h) == 0) {
 		return;
 	}
+	_streaming_request();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, Rect2(p_pos, Size2(w, h)), texture, false, p_modulate, p_transpose);
 }
 
@@ -959,6 +1138,7 @@ void CompressedTexture2D::draw_rect(RID p_canvas_item, const Rect2 &p_rect, bool
 	if ((w | h) == 0) {
 		return;
 	}
+	_streaming_request();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, p_rect, texture, p_tile, p_modulate, p_transpose);
 }
 
@@ -966,6 +1146,7 @@ void CompressedTexture2D::draw_rect_region(RID p_canvas_item, const Rect2 &p_rec
 	if ((w | h) == 0) {
 		return;
 	}
+	_streaming_request();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, p_rect, texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
 }
 
@@ -1040,9 +1221,18 @@ void CompressedTexture2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
-CompressedTexture2D::CompressedTexture2D() {}
+CompressedTexture2D::CompressedTexture2D() :
+		streaming_resident_element(this) {
+}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	if (streaming_state.get() != STREAMING_DISABLED) {
+		MutexLock lock(streaming_mutex);
+		if (streaming_resident_element.in_list()) {
+			streaming_resident.remove(&streaming_resident_element);
+			streaming_resident_size -= streaming_full_size;
+		}
+	}
 	if (texture.is_valid()) {
 		RS::get_singleton()->free(texture);
 	}
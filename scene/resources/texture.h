@@ -35,9 +35,12 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/math/rect2.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/os/rw_lock.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/curve.h"
 #include "scene/resources/gradient.h"
 #include "servers/camera_server.h"
@@ -243,6 +246,42 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Streaming, for textures imported as streamed. Only the mipmaps up to a small size are loaded at first,
+	// the full image is loaded in the background once the texture is used, within a global memory budget.
+	enum StreamingState {
+		STREAMING_DISABLED,
+		STREAMING_LOW, // Only the small mipmaps are resident.
+		STREAMING_PENDING, // The full image is being loaded.
+		STREAMING_FULL, // The full image is resident.
+	};
+
+	struct StreamingTask {
+		Ref<CompressedTexture2D> texture;
+		String path;
+		uint32_t generation = 0;
+	};
+
+	mutable SafeNumeric<uint32_t> streaming_state;
+	mutable SafeNumeric<uint64_t> streaming_last_used;
+	mutable WorkerThreadPool::TaskID streaming_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	mutable bool streaming_pinned = false;
+	uint32_t streaming_generation = 0;
+	uint64_t streaming_full_size = 0;
+	Ref<Image> streaming_low_image;
+	SelfList<CompressedTexture2D> streaming_resident_element;
+
+	static Mutex streaming_mutex;
+	static SelfList<CompressedTexture2D>::List streaming_resident;
+	static uint64_t streaming_resident_size;
+
+	void _streaming_request() const;
+	void _streaming_pin() const;
+	void _streaming_start_load() const;
+	void _streaming_evict();
+	void _streaming_reset(const Ref<Image> &p_low_image);
+	static void _streaming_load_task(void *p_userdata);
+	static void _streaming_finished(Ref<CompressedTexture2D> p_texture, Ref<Image> p_image, uint32_t p_generation);
+
 	virtual void reload_from_file() override;
 
 	static void _requested_3d(void *p_ud);
@@ -256,6 +295,10 @@ protected:
 public:
 	static Ref<Image> load_image_from_file(Ref<FileAccess> p_file, int p_size_limit);
 
+	// Evicts streamed textures not used since `p_frame`, least recently used first, until the resident ones fit in `p_budget` bytes.
+	static void streaming_fit_budget(uint64_t p_budget, uint64_t p_frame);
+	static uint64_t get_streaming_resident_size();
+
 	typedef void (*TextureFormatRequestCallback)(const Ref<CompressedTexture2D> &);
 	typedef void (*TextureFormatRoughnessRequestCallback)(const Ref<CompressedTexture2D> &, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 
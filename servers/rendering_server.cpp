@@ -2852,6 +2852,12 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/textures/lossless_compression/webp_compression_level", 2);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/lossless_compression/webp_compression_level", PropertyInfo(Variant::INT, "rendering/textures/lossless_compression/webp_compression_level", PROPERTY_HINT_RANGE, "0,9,1"));
 
+	GLOBAL_DEF("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF("rendering/textures/streaming/initial_size", 128);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/initial_size", PropertyInfo(Variant::INT, "rendering/textures/streaming/initial_size", PROPERTY_HINT_RANGE, "16,2048,1"));
+	GLOBAL_DEF("rendering/textures/streaming/memory_budget_mb", 512);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/memory_budget_mb", PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "16,16384,1,or_greater,suffix:MiB"));
+
 	GLOBAL_DEF("rendering/limits/time/time_rollover_secs", 3600);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/limits/time/time_rollover_secs", PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "0,10000,1,or_greater"));
 
@@ -0,0 +1,20 @@
+extends RefCounted
+
+# Runs `callable` `repeats` times and prints the fastest run, which is the least
+# affected by other processes and by caches warming up.
+static func run(name: String, callable: Callable, repeats: int = 5) -> int:
+	var best := -1
+	for i in repeats:
+		var start := Time.get_ticks_usec()
+		callable.call()
+		var elapsed := Time.get_ticks_usec() - start
+		if best < 0 or elapsed < best:
+			best = elapsed
+	report(name, best)
+	return best
+
+
+# Prints a time measured by the benchmark itself, for cases `run()` can't time,
+# such as whole frames.
+static func report(name: String, usec: int) -> void:
+	print("%-48s %10.3f ms" % [name, usec / 1000.0])
@@ -0,0 +1,100 @@
+extends SceneTree
+
+# Inner loops of fully typed code, which run on the VM's typed opcodes where
+# possible. Run with:
+#   godot --headless --path tests/benchmarks -s res://gdscript/typed_loops.gd
+
+const Benchmark = preload("res://benchmark.gd")
+const ARRAY_SIZE = 1000
+const ARRAY_PASSES = 1000
+const ITERATIONS = ARRAY_SIZE * ARRAY_PASSES
+
+var counter: int = 0
+
+
+func _init() -> void:
+	print("GDScript typed loops, %d iterations" % ITERATIONS)
+	Benchmark.run("int arithmetic", _int_arithmetic)
+	Benchmark.run("float arithmetic", _float_arithmetic)
+	Benchmark.run("Vector2 arithmetic", _vector2_arithmetic)
+	Benchmark.run("typed Array[int] sum", _typed_array_sum)
+	Benchmark.run("PackedInt64Array sum", _packed_array_sum)
+	Benchmark.run("static function calls", _static_calls)
+	Benchmark.run("member variable increments", _member_increments)
+	Benchmark.run("nested range() loops", _nested_ranges)
+	quit()
+
+
+func _int_arithmetic() -> void:
+	var sum: int = 0
+	for i in ITERATIONS:
+		sum += (i * 3) % 7 - (i >> 2)
+	assert(sum != 0)
+
+
+func _float_arithmetic() -> void:
+	var sum: float = 0.0
+	var x: float = 0.5
+	for i in ITERATIONS:
+		sum += x * 1.0001 - sum * 0.0001
+		x += 0.25
+	assert(sum != 0.0)
+
+
+func _vector2_arithmetic() -> void:
+	var position := Vector2()
+	var velocity := Vector2(1.0, 0.5)
+	for i in ITERATIONS:
+		velocity = velocity * 0.999 + Vector2(0.0, 0.01)
+		position += velocity
+	assert(position != Vector2())
+
+
+func _typed_array_sum() -> void:
+	var values: Array[int] = []
+	values.resize(ARRAY_SIZE)
+	for i in values.size():
+		values[i] = i
+	var sum: int = 0
+	for _pass in ARRAY_PASSES:
+		for value in values:
+			sum += value
+	assert(sum != 0)
+
+
+func _packed_array_sum() -> void:
+	var values := PackedInt64Array()
+	values.resize(ARRAY_SIZE)
+	for i in values.size():
+		values[i] = i
+	var sum: int = 0
+	for _pass in ARRAY_PASSES:
+		for i in values.size():
+			sum += values[i]
+	assert(sum != 0)
+
+
+static func _clamp_add(a: int, b: int) -> int:
+	return clampi(a + b, -1000, 1000)
+
+
+func _static_calls() -> void:
+	var value: int = 0
+	for i in ITERATIONS:
+		value = _clamp_add(value, i & 3)
+	assert(value != 0)
+
+
+func _member_increments() -> void:
+	counter = 0
+	for i in ITERATIONS:
+		counter += 1
+	assert(counter == ITERATIONS)
+
+
+func _nested_ranges() -> void:
+	var sum: int = 0
+	for y in range(0, ARRAY_PASSES):
+		for x in range(0, ARRAY_SIZE, 1):
+			sum += x ^ y
+	assert(sum != 0)
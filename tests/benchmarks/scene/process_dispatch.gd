@@ -0,0 +1,76 @@
+extends SceneTree
+
+# Frame time of dispatching the process notification to many nodes whose
+# callback does nothing, so the cost is the tree walking its process list.
+# Compare builds from before and after a change to the dispatch. Run with:
+#   godot --headless --path tests/benchmarks -s res://scene/process_dispatch.gd
+
+const Benchmark = preload("res://benchmark.gd")
+const NODE_COUNT = 100000
+const WARMUP_FRAMES = 5
+const MEASURED_FRAMES = 20
+
+enum Case {
+	ALL_PROCESSING,
+	HALF_DISABLED,
+	PAUSED,
+}
+
+const CASE_NAMES = ["all nodes processing", "half of the nodes disabled", "paused, 1% of the nodes always processing"]
+
+
+class EmptyProcessNode extends Node:
+	func _process(_delta: float) -> void:
+		pass
+
+
+var scene: Node
+var current_case := 0
+var frame := 0
+var frame_start := 0
+var best := -1
+
+
+func _initialize() -> void:
+	print("Process dispatch, %d nodes" % NODE_COUNT)
+	_build_scene(current_case)
+
+
+# Called before the tree processes its nodes, so the time between two calls is
+# one whole frame.
+func _process(_delta: float) -> bool:
+	var now := Time.get_ticks_usec()
+	if frame > WARMUP_FRAMES:
+		var elapsed := now - frame_start
+		if best < 0 or elapsed < best:
+			best = elapsed
+	frame_start = now
+	frame += 1
+	if frame <= WARMUP_FRAMES + MEASURED_FRAMES:
+		return false
+
+	Benchmark.report(CASE_NAMES[current_case], best)
+
+	paused = false
+	scene.free()
+	current_case += 1
+	if current_case == CASE_NAMES.size():
+		return true
+
+	frame = 0
+	best = -1
+	_build_scene(current_case)
+	return false
+
+
+func _build_scene(test_case: int) -> void:
+	scene = Node.new()
+	for i in NODE_COUNT:
+		var node := EmptyProcessNode.new()
+		if test_case == Case.HALF_DISABLED and i % 2 == 0:
+			node.process_mode = Node.PROCESS_MODE_DISABLED
+		elif test_case == Case.PAUSED and i % 100 == 0:
+			node.process_mode = Node.PROCESS_MODE_ALWAYS
+		scene.add_child(node)
+	root.add_child(scene)
+	paused = test_case == Case.PAUSED
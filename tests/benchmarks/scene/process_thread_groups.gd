@@ -0,0 +1,79 @@
+extends SceneTree
+
+# Frame time of processing many nodes with a script, all on the main thread and
+# then split into an increasing number of sub-thread process groups. Run with:
+#   godot --headless --path tests/benchmarks -s res://scene/process_thread_groups.gd
+# Groups run on the WorkerThreadPool, so they can't use more threads than
+# "threading/worker_pool/max_threads" (the processor count by default).
+
+const Benchmark = preload("res://benchmark.gd")
+const NODE_COUNT = 100000
+# 0 processes every node on the main thread.
+const GROUP_COUNTS = [0, 1, 2, 4, 8, 16]
+const WARMUP_FRAMES = 5
+const MEASURED_FRAMES = 20
+
+
+class ProcessedNode extends Node:
+	var value := 0.0
+
+	func _process(delta: float) -> void:
+		value += delta - value * 0.001
+
+
+var scene: Node
+var config := 0
+var frame := 0
+var frame_start := 0
+var best := -1
+
+
+func _initialize() -> void:
+	print("Process thread groups, %d nodes, %d processors" % [NODE_COUNT, OS.get_processor_count()])
+	_build_scene(GROUP_COUNTS[config])
+
+
+# Called before the tree processes its nodes, so the time between two calls is
+# one whole frame.
+func _process(_delta: float) -> bool:
+	var now := Time.get_ticks_usec()
+	if frame > WARMUP_FRAMES:
+		var elapsed := now - frame_start
+		if best < 0 or elapsed < best:
+			best = elapsed
+	frame_start = now
+	frame += 1
+	if frame <= WARMUP_FRAMES + MEASURED_FRAMES:
+		return false
+
+	var group_count: int = GROUP_COUNTS[config]
+	if group_count == 0:
+		Benchmark.report("main thread", best)
+	else:
+		Benchmark.report("%d sub-thread groups" % group_count, best)
+
+	scene.free()
+	config += 1
+	if config == GROUP_COUNTS.size():
+		return true
+
+	frame = 0
+	best = -1
+	_build_scene(GROUP_COUNTS[config])
+	return false
+
+
+func _build_scene(group_count: int) -> void:
+	scene = Node.new()
+	var parents := [scene]
+	if group_count > 0:
+		parents.clear()
+		for i in group_count:
+			var group_root := Node.new()
+			group_root.process_thread_group = Node.PROCESS_THREAD_GROUP_SUB_THREAD
+			scene.add_child(group_root)
+			parents.push_back(group_root)
+
+	for i in NODE_COUNT:
+		parents[i % parents.size()].add_child(ProcessedNode.new())
+	root.add_child(scene)
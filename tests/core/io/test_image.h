@@ -32,6 +32,7 @@
 #define TEST_IMAGE_H
 
 #include "core/io/image.h"
+#include "core/io/image_loader.h"
 #include "core/os/os.h"
 
 #include "tests/test_utils.h"
@@ -155,6 +156,47 @@ TEST_CASE("[Image] Saving and loading") {
 			"The TGA image should load successfully.");
 }
 
+TEST_CASE("[Image] Loading at a reduced scale") {
+	// JPG, decoded in blocks of 4x4 pixels.
+	Ref<Image> image_jpg = memnew(Image());
+	CHECK_MESSAGE(
+			ImageLoader::load_image(TestUtils::get_data_path("images/icon.jpg"), image_jpg, Ref<FileAccess>(), ImageFormatLoader::FLAG_NONE, 0.25) == OK,
+			"The JPG image should load successfully at a reduced scale.");
+	CHECK(image_jpg->get_size() == Vector2(64, 64));
+	CHECK(image_jpg->get_format() == Image::FORMAT_RGB8);
+
+	// JPG, decoded in blocks of 2x2 pixels then resized.
+	CHECK(ImageLoader::load_image(TestUtils::get_data_path("images/icon.jpg"), image_jpg, Ref<FileAccess>(), ImageFormatLoader::FLAG_NONE, 0.3) == OK);
+	CHECK(image_jpg->get_size() == Vector2(77, 77));
+
+	// WebP, scaled by the decoder.
+	Ref<Image> image_webp = memnew(Image());
+	CHECK_MESSAGE(
+			ImageLoader::load_image(TestUtils::get_data_path("images/icon.webp"), image_webp, Ref<FileAccess>(), ImageFormatLoader::FLAG_NONE, 0.25) == OK,
+			"The WebP image should load successfully at a reduced scale.");
+	CHECK(image_webp->get_size() == Vector2(64, 64));
+
+	// The average color of the reduced image should match the full size one.
+	Ref<Image> full_jpg = memnew(Image());
+	CHECK(ImageLoader::load_image(TestUtils::get_data_path("images/icon.jpg"), full_jpg) == OK);
+	CHECK(ImageLoader::load_image(TestUtils::get_data_path("images/icon.jpg"), image_jpg, Ref<FileAccess>(), ImageFormatLoader::FLAG_NONE, 0.25) == OK);
+	Color full_average;
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) {
+			full_average += full_jpg->get_pixel(x, y) / (256 * 256);
+		}
+	}
+	Color reduced_average;
+	for (int y = 0; y < 64; y++) {
+		for (int x = 0; x < 64; x++) {
+			reduced_average += image_jpg->get_pixel(x, y) / (64 * 64);
+		}
+	}
+	CHECK_MESSAGE(
+			Math::abs(full_average.r - reduced_average.r) + Math::abs(full_average.g - reduced_average.g) + Math::abs(full_average.b - reduced_average.b) < 0.02,
+			"The reduced JPG image should have the same average color as the full size image.");
+}
+
 TEST_CASE("[Image] Basic getters") {
 	Ref<Image> image = memnew(Image(8, 4, false, Image::FORMAT_LA8));
 	CHECK(image->get_width() == 8);
@@ -299,6 +341,68 @@ TEST_CASE("[Image] Modifying pixels of an image") {
 			image3->get_pixel(1, 0).is_equal_approx(Color(0, 0, 0, 0)),
 			"flip_y() should not leave old pixels behind.");
 }
+
+TEST_CASE("[Image] Processing large images") {
+	// Large enough for the operations to be split in ranges of rows.
+	const int size = 512;
+	Vector<uint8_t> pixels;
+	pixels.resize(size * size * 4);
+	uint8_t *w = pixels.ptrw();
+	for (int i = 0; i < size * size * 4; i++) {
+		w[i] = (i * 7 + i / 13) & 0xFF;
+	}
+	Ref<Image> source = memnew(Image(size, size, false, Image::FORMAT_RGBA8, pixels));
+
+	// premultiply_alpha()
+	Ref<Image> premultiplied = source->duplicate();
+	premultiplied->premultiply_alpha();
+	const uint8_t *r = premultiplied->get_data().ptr();
+	bool premultiply_ok = true;
+	for (int i = 0; i < size * size && premultiply_ok; i++) {
+		for (int k = 0; k < 3; k++) {
+			premultiply_ok = premultiply_ok && r[i * 4 + k] == ((uint16_t(w[i * 4 + k]) * uint16_t(w[i * 4 + 3])) >> 8);
+		}
+		premultiply_ok = premultiply_ok && r[i * 4 + 3] == w[i * 4 + 3];
+	}
+	CHECK_MESSAGE(premultiply_ok, "premultiply_alpha() should process every pixel of a large image.");
+
+	// resize()
+	Ref<Image> resized = source->duplicate();
+	resized->resize(size / 2, size / 2, Image::INTERPOLATE_NEAREST);
+	bool resize_ok = true;
+	for (int y = 0; y < size / 2 && resize_ok; y++) {
+		for (int x = 0; x < size / 2 && resize_ok; x++) {
+			resize_ok = resized->get_pixel(x, y) == source->get_pixel(x * 2, y * 2);
+		}
+	}
+	CHECK_MESSAGE(resize_ok, "Nearest neighbor resize() should sample the expected pixels of a large image.");
+
+	// convert()
+	Ref<Image> converted = source->duplicate();
+	converted->convert(Image::FORMAT_RGBAF);
+	bool convert_ok = true;
+	for (int y = 0; y < size && convert_ok; y++) {
+		for (int x = 0; x < size && convert_ok; x++) {
+			convert_ok = converted->get_pixel(x, y) == source->get_pixel(x, y);
+		}
+	}
+	CHECK_MESSAGE(convert_ok, "convert() should convert every pixel of a large image.");
+
+	// blend_rect()
+	Ref<Image> blended = memnew(Image(size, size, false, Image::FORMAT_RGBA8));
+	blended->fill(Color(0.2, 0.4, 0.6, 0.5));
+	Ref<Image> expected = blended->duplicate();
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			Color sc = source->get_pixel(x, y);
+			if (sc.a != 0) {
+				expected->set_pixel(x, y, expected->get_pixel(x, y).blend(sc));
+			}
+		}
+	}
+	blended->blend_rect(source, Rect2i(0, 0, size, size), Vector2i(0, 0));
+	CHECK_MESSAGE(blended->get_data() == expected->get_data(), "blend_rect() should give the same result as Color.blend() on every pixel.");
+}
 } // namespace TestImage
 
 #endif // TEST_IMAGE_H
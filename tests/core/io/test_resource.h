@@ -36,7 +36,7 @@
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
 
-#include "thirdparty/doctest/doctest.h"
+#include "tests/test_macros.h"
 
 namespace TestResource {
 
@@ -109,6 +109,87 @@ TEST_CASE("[Resource] Saving and loading") {
 			loaded_child_resource_text->get_name() == "I'm a child resource",
 			"The loaded child resource name should be equal to the expected value.");
 }
+
+TEST_CASE("[Resource] Saving and loading packed arrays in binary format") {
+	Ref<Resource> resource = memnew(Resource);
+	PackedByteArray bytes;
+	PackedInt32Array ints;
+	PackedInt64Array longs;
+	PackedFloat32Array floats;
+	PackedFloat64Array doubles;
+	PackedVector2Array vector2s;
+	PackedVector3Array vector3s;
+	PackedColorArray colors;
+	for (int i = 0; i < 1001; i++) {
+		bytes.push_back(i % 256);
+		ints.push_back(-i * 1000);
+		longs.push_back(int64_t(i) << 40);
+		floats.push_back(i * 0.25);
+		doubles.push_back(i * 0.125);
+		vector2s.push_back(Vector2(i, -i));
+		vector3s.push_back(Vector3(i, i * 0.5, -i));
+		colors.push_back(Color(i / 1000.0, 0.5, 0.25, 1.0));
+	}
+	resource->set_meta("bytes", bytes);
+	resource->set_meta("ints", ints);
+	resource->set_meta("longs", longs);
+	resource->set_meta("floats", floats);
+	resource->set_meta("doubles", doubles);
+	resource->set_meta("vector2s", vector2s);
+	resource->set_meta("vector3s", vector3s);
+	resource->set_meta("colors", colors);
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("packed_arrays.res");
+	const uint32_t flags[2] = { 0, ResourceSaver::FLAG_SAVE_BIG_ENDIAN };
+	for (uint32_t flag : flags) {
+		ResourceSaver::save(resource, save_path, flag);
+		const Ref<Resource> &loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE(loaded.is_valid());
+		CHECK(PackedByteArray(loaded->get_meta("bytes")) == bytes);
+		CHECK(PackedInt32Array(loaded->get_meta("ints")) == ints);
+		CHECK(PackedInt64Array(loaded->get_meta("longs")) == longs);
+		CHECK(PackedFloat32Array(loaded->get_meta("floats")) == floats);
+		CHECK(PackedFloat64Array(loaded->get_meta("doubles")) == doubles);
+		CHECK(PackedVector2Array(loaded->get_meta("vector2s")) == vector2s);
+		CHECK(PackedVector3Array(loaded->get_meta("vector3s")) == vector3s);
+		CHECK(PackedColorArray(loaded->get_meta("colors")) == colors);
+	}
+}
+
+TEST_CASE("[Resource] Loading a single sub-resource from a binary file") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Library");
+	Ref<Resource> first = memnew(Resource);
+	first->set_name("First");
+	first->set_scene_unique_id("first");
+	Ref<Resource> second = memnew(Resource);
+	second->set_name("Second");
+	second->set_scene_unique_id("second");
+	Ref<Resource> nested = memnew(Resource);
+	nested->set_name("Nested");
+	second->set_meta("nested", nested);
+	resource->set_meta("first", first);
+	resource->set_meta("second", second);
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("sub_resources.res");
+	ResourceSaver::save(resource, save_path);
+
+	const Ref<Resource> &loaded_second = ResourceLoader::load(save_path + "::second", "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_second.is_valid());
+	CHECK_MESSAGE(
+			loaded_second->get_name() == "Second",
+			"The loaded sub-resource should be the one requested.");
+	const Ref<Resource> &loaded_nested = loaded_second->get_meta("nested");
+	REQUIRE(loaded_nested.is_valid());
+	CHECK_MESSAGE(
+			loaded_nested->get_name() == "Nested",
+			"Sub-resources the requested one depends on should be loaded too.");
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(
+			ResourceLoader::load(save_path + "::missing", "", ResourceFormatLoader::CACHE_MODE_IGNORE).is_null(),
+			"Loading a sub-resource which doesn't exist should fail.");
+	ERR_PRINT_ON;
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
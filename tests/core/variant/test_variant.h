@@ -789,6 +789,37 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays longer than the readahead buffer") {
+	PackedFloat32Array floats;
+	PackedVector3Array vectors;
+	PackedStringArray strings;
+	for (int i = 0; i < 2000; i++) {
+		floats.push_back(i * 0.5);
+		vectors.push_back(Vector3(i, -i, i * 0.25));
+		strings.push_back(itos(i));
+	}
+	Array a = build_array(floats, vectors, strings);
+
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+
+	String errs;
+	int line = 1;
+	Variant a_parsed;
+
+	VariantParser::StreamString ss;
+	ss.s = a_str;
+	CHECK(VariantParser::parse(&ss, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back when reading ahead.");
+
+	VariantParser::StreamString ss_no_readahead(false);
+	ss_no_readahead.s = a_str;
+	line = 1;
+	a_parsed = Variant();
+	CHECK(VariantParser::parse(&ss_no_readahead, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back when reading one character at a time.");
+}
+
 TEST_CASE("[Variant] Writer recursive dictionary") {
 	// There is no way to accurately represent a recursive dictionary,
 	// the only thing we can do is make sure the writer doesn't blow up
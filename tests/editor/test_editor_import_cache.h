@@ -0,0 +1,141 @@
+/*************************************************************************/
+/*  test_editor_import_cache.h                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_EDITOR_IMPORT_CACHE_H
+#define TEST_EDITOR_IMPORT_CACHE_H
+
+#ifdef TOOLS_ENABLED
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "editor/editor_import_cache.h"
+#include "editor/import/resource_importer_wav.h"
+
+#include "tests/test_macros.h"
+
+namespace TestEditorImportCache {
+
+static void _write_file(const String &p_path, const String &p_contents) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_contents);
+}
+
+static String _read_file(const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	return f.is_valid() ? f->get_as_utf8_string() : String();
+}
+
+TEST_CASE("[EditorImportCache] Hits, misses and invalidation") {
+	String test_dir = OS::get_singleton()->get_cache_path().path_join("test_editor_import_cache");
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->dir_exists(test_dir)) {
+		Ref<DirAccess> test_da = DirAccess::open(test_dir);
+		test_da->erase_contents_recursive();
+	}
+	REQUIRE(da->make_dir_recursive(test_dir) == OK);
+
+	EditorImportCache cache;
+	cache.set_cache_dir(test_dir.path_join("cache"));
+
+	Ref<ResourceImporterWAV> importer = memnew(ResourceImporterWAV);
+	List<ResourceImporter::ImportOption> options_list;
+	importer->get_import_options("", &options_list);
+	HashMap<StringName, Variant> params;
+	for (const ResourceImporter::ImportOption &E : options_list) {
+		params[E.option.name] = E.default_value;
+	}
+
+	String source_path = test_dir.path_join("source.wav");
+	String base_path = test_dir.path_join("imported");
+	String imported_path = base_path + "." + importer->get_save_extension();
+	_write_file(source_path, "source data");
+	_write_file(imported_path, "imported data");
+
+	String key = EditorImportCache::get_key(source_path, importer, params);
+	List<String> variants;
+	Variant meta;
+
+	SUBCASE("Nothing is found before saving") {
+		CHECK_FALSE(cache.load(key, base_path, importer, &variants, &meta));
+	}
+
+	SUBCASE("Saved imports are copied back") {
+		cache.save(key, base_path, importer, List<String>(), 42);
+		REQUIRE(da->remove(imported_path) == OK);
+
+		CHECK(cache.load(key, base_path, importer, &variants, &meta));
+		CHECK(_read_file(imported_path) == "imported data");
+		CHECK(variants.is_empty());
+		CHECK(int(meta) == 42);
+	}
+
+	SUBCASE("Identical sources share the key") {
+		String copy_path = test_dir.path_join("copy.wav");
+		_write_file(copy_path, "source data");
+		CHECK(EditorImportCache::get_key(copy_path, importer, params) == key);
+	}
+
+	SUBCASE("Changing the source or the options changes the key") {
+		cache.save(key, base_path, importer, List<String>(), Variant());
+
+		_write_file(source_path, "other source data");
+		String changed_source_key = EditorImportCache::get_key(source_path, importer, params);
+		CHECK(changed_source_key != key);
+		CHECK_FALSE(cache.load(changed_source_key, base_path, importer, &variants, &meta));
+
+		_write_file(source_path, "source data");
+		params["force/mono"] = !bool(params["force/mono"]);
+		String changed_options_key = EditorImportCache::get_key(source_path, importer, params);
+		CHECK(changed_options_key != key);
+		CHECK_FALSE(cache.load(changed_options_key, base_path, importer, &variants, &meta));
+	}
+
+	SUBCASE("Entries are evicted past the size limit") {
+		cache.save(key, base_path, importer, List<String>(), Variant());
+
+		cache.evict(1024 * 1024);
+		CHECK(cache.load(key, base_path, importer, &variants, &meta));
+
+		cache.evict(0);
+		CHECK_FALSE(cache.load(key, base_path, importer, &variants, &meta));
+	}
+
+	Ref<DirAccess> test_da = DirAccess::open(test_dir);
+	test_da->erase_contents_recursive();
+	da->remove(test_dir);
+}
+
+} // namespace TestEditorImportCache
+
+#endif // TOOLS_ENABLED
+
+#endif // TEST_EDITOR_IMPORT_CACHE_H
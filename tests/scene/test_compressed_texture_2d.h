@@ -0,0 +1,218 @@
+/*************************************************************************/
+/*  test_compressed_texture_2d.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_COMPRESSED_TEXTURE_2D_H
+#define TEST_COMPRESSED_TEXTURE_2D_H
+
+#include "core/config/project_settings.h"
+#include "core/config/engine.h"
+#include "core/io/file_access.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "scene/resources/texture.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompressedTexture2D {
+
+static Ref<Image> _create_mipmapped_image() {
+	Ref<Image> image = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+	for (int y = 0; y < 64; y++) {
+		for (int x = 0; x < 64; x++) {
+			image->set_pixel(x, y, Color(x / 63.0, y / 63.0, 0.5));
+		}
+	}
+	image->generate_mipmaps();
+	return image;
+}
+
+// Writes the image the way the texture importer does for streamed textures.
+static String _save_streamed_ctex(const String &p_name, const Ref<Image> &p_image, bool p_png) {
+	String path = OS::get_singleton()->get_cache_path().path_join(p_name);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+
+	f->store_buffer((const uint8_t *)"GST2", 4);
+	f->store_32(CompressedTexture2D::FORMAT_VERSION);
+	f->store_32(p_image->get_width());
+	f->store_32(p_image->get_height());
+	f->store_32(CompressedTexture2D::FORMAT_BIT_STREAM | CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS);
+	f->store_32(0); // Mipmap limit.
+	f->store_32(0);
+	f->store_32(0);
+	f->store_32(0);
+
+	f->store_32(p_png ? CompressedTexture2D::DATA_FORMAT_PNG : CompressedTexture2D::DATA_FORMAT_IMAGE);
+	f->store_16(p_image->get_width());
+	f->store_16(p_image->get_height());
+	f->store_32(p_image->get_mipmap_count());
+	f->store_32(p_image->get_format());
+
+	if (p_png) {
+		for (int i = 0; i < p_image->get_mipmap_count() + 1; i++) {
+			Vector<uint8_t> data = Image::png_packer(p_image->get_image_from_mipmap(i));
+			f->store_32(data.size());
+			f->store_buffer(data.ptr(), data.size());
+		}
+	} else {
+		f->store_buffer(p_image->get_data().ptr(), p_image->get_data().size());
+	}
+
+	return path;
+}
+
+TEST_CASE("[CompressedTexture2D] Loading within a size limit") {
+	Ref<Image> image = _create_mipmapped_image();
+	const int first_kept_ofs = image->get_mipmap_offset(2); // 16x16.
+
+	SUBCASE("Uncompressed image data") {
+		String path = _save_streamed_ctex("test_streamed_image.ctex", image, false);
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+		f->seek(36); // Header.
+
+		Ref<Image> loaded = CompressedTexture2D::load_image_from_file(f, 16);
+		REQUIRE(loaded.is_valid());
+		CHECK(loaded->get_width() == 16);
+		CHECK(loaded->get_height() == 16);
+		CHECK(loaded->has_mipmaps());
+		CHECK(loaded->get_data() == image->get_data().slice(first_kept_ofs));
+	}
+
+	SUBCASE("PNG mipmaps") {
+		String path = _save_streamed_ctex("test_streamed_png.ctex", image, true);
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+		f->seek(36);
+
+		Ref<Image> loaded = CompressedTexture2D::load_image_from_file(f, 16);
+		REQUIRE(loaded.is_valid());
+		CHECK(loaded->get_width() == 16);
+		CHECK(loaded->get_height() == 16);
+		CHECK(loaded->has_mipmaps());
+		CHECK(loaded->get_data() == image->get_data().slice(first_kept_ofs));
+	}
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Loading a streamed texture") {
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size", 16);
+
+	Ref<Image> image = _create_mipmapped_image();
+	String path = _save_streamed_ctex("test_streamed_texture.ctex", image, true);
+
+	Ref<CompressedTexture2D> texture;
+	texture.instantiate();
+	CHECK(texture->load(path) == OK);
+
+	// The full size is reported, even though only the small mipmaps are loaded.
+	CHECK(texture->get_width() == 64);
+	CHECK(texture->get_height() == 64);
+	Ref<Image> loaded = texture->get_image();
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_width() == 16);
+	CHECK(loaded->has_mipmaps());
+	CHECK(loaded->get_data() == image->get_data().slice(image->get_mipmap_offset(2)));
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size", 128);
+}
+
+// Applies the streamed textures once loaded in the background, until the resident size reaches `p_size`.
+static bool _wait_for_streaming_resident_size(uint64_t p_size) {
+	for (int i = 0; i < 1000; i++) {
+		MessageQueue::get_singleton()->flush();
+		if (CompressedTexture2D::get_streaming_resident_size() == p_size) {
+			return true;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return false;
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Streaming memory budget") {
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size", 16);
+
+	Ref<Image> image = _create_mipmapped_image();
+	const uint64_t full_size = image->get_data().size();
+	const uint64_t base_size = CompressedTexture2D::get_streaming_resident_size();
+	RID canvas_item = RS::get_singleton()->canvas_item_create();
+
+	Ref<CompressedTexture2D> textures[3];
+	for (int i = 0; i < 3; i++) {
+		textures[i].instantiate();
+		CHECK(textures[i]->load(_save_streamed_ctex(vformat("test_streaming_budget_%d.ctex", i), image, false)) == OK);
+		textures[i]->draw(canvas_item, Point2());
+	}
+	REQUIRE(_wait_for_streaming_resident_size(base_size + 3 * full_size));
+
+	const uint64_t frame = Engine::get_singleton()->get_process_frames();
+
+	SUBCASE("Textures used during the current frame are kept") {
+		CompressedTexture2D::streaming_fit_budget(base_size, frame);
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size + 3 * full_size);
+	}
+
+	SUBCASE("Textures are evicted until the budget is met") {
+		CompressedTexture2D::streaming_fit_budget(base_size + 2 * full_size, frame + 1);
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size + 2 * full_size);
+
+		CompressedTexture2D::streaming_fit_budget(base_size, frame + 1);
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size);
+
+		// Evicted textures are loaded again when drawn.
+		textures[0]->draw(canvas_item, Point2());
+		CHECK(_wait_for_streaming_resident_size(base_size + full_size));
+	}
+
+	SUBCASE("Textures used through their RID are left out of the budget") {
+		textures[0]->get_rid();
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size + 2 * full_size);
+
+		CompressedTexture2D::streaming_fit_budget(base_size, frame + 1);
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size);
+
+		// Drawing a pinned texture doesn't stream it again.
+		textures[0]->draw(canvas_item, Point2());
+		MessageQueue::get_singleton()->flush();
+		CHECK(CompressedTexture2D::get_streaming_resident_size() == base_size);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		textures[i].unref();
+	}
+	RS::get_singleton()->free(canvas_item);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size", 128);
+}
+
+} // namespace TestCompressedTexture2D
+
+#endif // TEST_COMPRESSED_TEXTURE_2D_H
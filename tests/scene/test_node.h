@@ -0,0 +1,394 @@
+/*************************************************************************/
+/*  test_node.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_H
+#define TEST_NODE_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/node.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode {
+
+class ProcessThreadRecorder : public Node {
+	GDCLASS(ProcessThreadRecorder, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			process_count++;
+			thread_id = Thread::get_caller_id();
+		}
+	}
+
+public:
+	int process_count = 0;
+	Thread::ID thread_id = 0;
+
+	ProcessThreadRecorder() {
+		set_process(true);
+	}
+};
+
+class ProcessRemover : public Node {
+	GDCLASS(ProcessRemover, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS && target) {
+			target->get_parent()->remove_child(target);
+			target = nullptr;
+		}
+	}
+
+public:
+	Node *target = nullptr;
+
+	ProcessRemover() {
+		set_process(true);
+		set_process_priority(-1);
+	}
+};
+
+class ProcessFreer : public Node {
+	GDCLASS(ProcessFreer, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS && target) {
+			memdelete(target);
+			target = nullptr;
+		}
+	}
+
+public:
+	Node *target = nullptr;
+
+	ProcessFreer() {
+		set_process(true);
+	}
+};
+
+class ProcessModeChanger : public Node {
+	GDCLASS(ProcessModeChanger, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS && target) {
+			target->set_process_mode(PROCESS_MODE_DISABLED);
+			SceneTree::get_singleton()->set_pause(true);
+			target = nullptr;
+		}
+	}
+
+public:
+	Node *target = nullptr;
+
+	ProcessModeChanger() {
+		set_process(true);
+	}
+};
+
+class TransformRecorder3D : public Node3D {
+	GDCLASS(TransformRecorder3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	TransformRecorder3D() {
+		set_notify_transform(true);
+	}
+};
+
+class TransformRecorder2D : public Node2D {
+	GDCLASS(TransformRecorder2D, Node2D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	TransformRecorder2D() {
+		set_notify_transform(true);
+	}
+};
+
+// Moves the 2D and 3D nodes next to it.
+class ProcessMover : public Node {
+	GDCLASS(ProcessMover, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			Node *parent = get_parent();
+			for (int i = 0; i < parent->get_child_count(); i++) {
+				Node3D *node_3d = Object::cast_to<Node3D>(parent->get_child(i));
+				if (node_3d) {
+					node_3d->set_position(node_3d->get_position() + Vector3(1, 0, 0));
+				}
+				Node2D *node_2d = Object::cast_to<Node2D>(parent->get_child(i));
+				if (node_2d) {
+					node_2d->set_position(node_2d->get_position() + Vector2(1, 0));
+				}
+			}
+		}
+	}
+
+public:
+	ProcessMover() {
+		set_process(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Process list") {
+	Node *scene = memnew(Node);
+	ProcessRemover *remover = memnew(ProcessRemover);
+	ProcessThreadRecorder *removed = memnew(ProcessThreadRecorder);
+	ProcessThreadRecorder *kept = memnew(ProcessThreadRecorder);
+	scene->add_child(kept);
+	scene->add_child(removed);
+	scene->add_child(remover);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	SUBCASE("Nodes removed while processing are skipped") {
+		remover->target = removed;
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(removed->process_count == 0);
+		CHECK(kept->process_count == 1);
+
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(removed->process_count == 0);
+		CHECK(kept->process_count == 2);
+		memdelete(removed);
+	}
+
+	SUBCASE("Pausing and process modes are taken into account") {
+		kept->set_process_mode(Node::PROCESS_MODE_ALWAYS);
+		SceneTree::get_singleton()->set_pause(true);
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(removed->process_count == 0);
+		CHECK(kept->process_count == 1);
+
+		SceneTree::get_singleton()->set_pause(false);
+		removed->set_process_mode(Node::PROCESS_MODE_DISABLED);
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(removed->process_count == 0);
+		CHECK(kept->process_count == 2);
+
+		removed->set_process_mode(Node::PROCESS_MODE_INHERIT);
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(removed->process_count == 1);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][Node] Process thread groups") {
+	const int group_count = 8;
+	const int nodes_per_group = 64;
+
+	Node *scene = memnew(Node);
+	ProcessThreadRecorder *main_thread_node = memnew(ProcessThreadRecorder);
+	scene->add_child(main_thread_node);
+
+	Vector<Node *> group_roots;
+	for (int i = 0; i < group_count; i++) {
+		Node *group_root = memnew(Node);
+		group_root->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		for (int j = 0; j < nodes_per_group; j++) {
+			group_root->add_child(memnew(ProcessThreadRecorder));
+		}
+		scene->add_child(group_root);
+		group_roots.push_back(group_root);
+	}
+
+	// Opting a node out of its parent's group.
+	ProcessThreadRecorder *opted_out = Object::cast_to<ProcessThreadRecorder>(group_roots[0]->get_child(0));
+	opted_out->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+	SceneTree::get_singleton()->process(0.1);
+
+	CHECK(main_thread_node->process_count == 1);
+	CHECK(main_thread_node->thread_id == Thread::get_main_id());
+	CHECK(opted_out->process_count == 1);
+	CHECK(opted_out->thread_id == Thread::get_main_id());
+
+	for (int i = 0; i < group_count; i++) {
+		// Nodes of the same group are processed on the same thread.
+		Thread::ID group_thread_id = Object::cast_to<ProcessThreadRecorder>(group_roots[i]->get_child(1))->thread_id;
+		for (int j = 1; j < nodes_per_group; j++) {
+			ProcessThreadRecorder *node = Object::cast_to<ProcessThreadRecorder>(group_roots[i]->get_child(j));
+			CHECK(node->process_count == 1);
+			CHECK(node->thread_id == group_thread_id);
+		}
+	}
+
+	SUBCASE("Changing the group of a node in the tree") {
+		Node *group_root = group_roots[1];
+		group_root->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+		SceneTree::get_singleton()->process(0.1);
+
+		for (int j = 0; j < nodes_per_group; j++) {
+			ProcessThreadRecorder *node = Object::cast_to<ProcessThreadRecorder>(group_root->get_child(j));
+			CHECK(node->process_count == 2);
+			CHECK(node->thread_id == Thread::get_main_id());
+		}
+	}
+
+	SUBCASE("Removing a group") {
+		Node *group_root = group_roots[2];
+		scene->remove_child(group_root);
+		SceneTree::get_singleton()->process(0.1);
+
+		CHECK(main_thread_node->process_count == 2);
+		for (int j = 0; j < nodes_per_group; j++) {
+			CHECK(Object::cast_to<ProcessThreadRecorder>(group_root->get_child(j))->process_count == 1);
+		}
+		memdelete(group_root);
+	}
+
+	SUBCASE("Freeing a node from a group") {
+		// Another group may be processing the node, so it must not be freed.
+		ProcessThreadRecorder *target = Object::cast_to<ProcessThreadRecorder>(group_roots[4]->get_child(0));
+		ObjectID target_id = target->get_instance_id();
+		ProcessFreer *freer = memnew(ProcessFreer);
+		freer->target = target;
+		group_roots[3]->add_child(freer);
+
+		ERR_PRINT_OFF;
+		SceneTree::get_singleton()->process(0.1);
+		ERR_PRINT_ON;
+
+		CHECK(ObjectDB::get_instance(target_id) == target);
+		CHECK(target->get_parent() == group_roots[4]);
+		CHECK(target->process_count == 2);
+
+		// Freeing it outside of group processing works.
+		memdelete(target);
+		CHECK(ObjectDB::get_instance(target_id) == nullptr);
+	}
+
+	SUBCASE("Changing process modes from a group") {
+		// Other groups may be checking whether their nodes can process.
+		ProcessThreadRecorder *target = Object::cast_to<ProcessThreadRecorder>(group_roots[4]->get_child(1));
+		ProcessModeChanger *changer = memnew(ProcessModeChanger);
+		changer->target = target;
+		group_roots[3]->add_child(changer);
+
+		ERR_PRINT_OFF;
+		SceneTree::get_singleton()->process(0.1);
+		ERR_PRINT_ON;
+
+		CHECK(target->get_process_mode() == Node::PROCESS_MODE_INHERIT);
+		CHECK_FALSE(SceneTree::get_singleton()->is_paused());
+		CHECK(target->process_count == 2);
+		CHECK(main_thread_node->process_count == 2);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][Node] Moving nodes from concurrent process thread groups") {
+	const int group_count = 8;
+	const int nodes_per_group = 32;
+	const int frame_count = 4;
+
+	Node *scene = memnew(Node);
+	for (int i = 0; i < group_count; i++) {
+		Node *group_root = memnew(Node);
+		group_root->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		group_root->add_child(memnew(ProcessMover));
+		for (int j = 0; j < nodes_per_group; j++) {
+			group_root->add_child(memnew(TransformRecorder3D));
+			group_root->add_child(memnew(TransformRecorder2D));
+		}
+		scene->add_child(group_root);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	// Leave out the notifications sent when entering the tree.
+	SceneTree::get_singleton()->process(0.1);
+	for (int i = 0; i < group_count; i++) {
+		Node *group_root = scene->get_child(i);
+		for (int j = 1; j < group_root->get_child_count(); j++) {
+			TransformRecorder3D *node_3d = Object::cast_to<TransformRecorder3D>(group_root->get_child(j));
+			if (node_3d) {
+				node_3d->transform_changed_count = 0;
+			}
+			TransformRecorder2D *node_2d = Object::cast_to<TransformRecorder2D>(group_root->get_child(j));
+			if (node_2d) {
+				node_2d->transform_changed_count = 0;
+			}
+		}
+	}
+
+	for (int frame = 0; frame < frame_count; frame++) {
+		SceneTree::get_singleton()->process(0.1);
+	}
+
+	// Every move made on the group threads got its notification on the main thread.
+	for (int i = 0; i < group_count; i++) {
+		Node *group_root = scene->get_child(i);
+		for (int j = 1; j < group_root->get_child_count(); j++) {
+			TransformRecorder3D *node_3d = Object::cast_to<TransformRecorder3D>(group_root->get_child(j));
+			if (node_3d) {
+				CHECK(node_3d->get_position() == Vector3(frame_count + 1, 0, 0));
+				CHECK(node_3d->transform_changed_count == frame_count);
+			}
+			TransformRecorder2D *node_2d = Object::cast_to<TransformRecorder2D>(group_root->get_child(j));
+			if (node_2d) {
+				CHECK(node_2d->get_position() == Vector2(frame_count + 1, 0));
+				CHECK(node_2d->transform_changed_count == frame_count);
+			}
+		}
+	}
+
+	memdelete(scene);
+}
+
+} // namespace TestNode
+
+#endif // TEST_NODE_H
@@ -0,0 +1,234 @@
+/*************************************************************************/
+/*  test_packed_scene.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PACKED_SCENE_H
+#define TEST_PACKED_SCENE_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedScene {
+
+static Ref<PackedScene> _create_test_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+	root->set_position(Vector2(1, 2));
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(0.5);
+	child->add_to_group("spawned", true);
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	CHECK(packed_scene->pack(root) == OK);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate restores packed properties") {
+	Ref<PackedScene> packed_scene = _create_test_scene();
+
+	// Instantiating twice goes through the cached instantiation plan the second time.
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "Root");
+		CHECK(instance->get_position().is_equal_approx(Vector2(1, 2)));
+
+		Node2D *child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(child != nullptr);
+		CHECK(child->get_owner() == instance);
+		CHECK(child->get_rotation() == doctest::Approx(0.5));
+		CHECK(child->is_in_group("spawned"));
+		memdelete(instance);
+	}
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate many") {
+	Ref<PackedScene> packed_scene = _create_test_scene();
+
+	TypedArray<Node> instances = packed_scene->instantiate_many(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node2D *instance = Object::cast_to<Node2D>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position().is_equal_approx(Vector2(1, 2)));
+		CHECK(instance->get_child_count() == 1);
+		memdelete(instance);
+	}
+
+	CHECK(packed_scene->instantiate_many(0).is_empty());
+}
+
+TEST_CASE("[SceneTree][PackedScene] Modifying the state invalidates the instantiation plan") {
+	Ref<PackedScene> packed_scene = _create_test_scene();
+	Node *instance = packed_scene->instantiate();
+	REQUIRE(instance != nullptr);
+	memdelete(instance);
+
+	Node2D *root = memnew(Node2D);
+	root->set_name("Other");
+	root->set_scale(Vector2(3, 3));
+	CHECK(packed_scene->pack(root) == OK);
+	memdelete(root);
+
+	Node2D *other = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(other != nullptr);
+	CHECK(other->get_name() == "Other");
+	CHECK(other->get_child_count() == 0);
+	CHECK(other->get_scale().is_equal_approx(Vector2(3, 3)));
+	memdelete(other);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instance pool") {
+	Ref<PackedScene> packed_scene = _create_test_scene();
+	packed_scene->set_path("res://pooled_scene.tscn", true);
+	uint64_t hits = PackedScene::get_instance_pool_hit_count();
+	uint64_t misses = PackedScene::get_instance_pool_miss_count();
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate_pooled());
+	REQUIRE(instance != nullptr);
+	CHECK(PackedScene::get_instance_pool_miss_count() == misses + 1);
+
+	SUBCASE("Released instances are reset and reused") {
+		instance->set_position(Vector2(10, 10));
+		instance->set_visible(false);
+		Node2D *child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		child->set_rotation(2.0);
+
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 1);
+		CHECK(PackedScene::get_pooled_node_count() >= 2);
+
+		Node2D *reused = Object::cast_to<Node2D>(packed_scene->instantiate_pooled());
+		CHECK(reused == instance);
+		CHECK(PackedScene::get_instance_pool_hit_count() == hits + 1);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+		CHECK(reused->get_position().is_equal_approx(Vector2(1, 2)));
+		CHECK(reused->is_visible());
+		CHECK(child->get_rotation() == doctest::Approx(0.5));
+		memdelete(reused);
+	}
+
+	SUBCASE("Instances whose structure changed are not pooled") {
+		memdelete(instance->get_node(NodePath("Child")));
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+
+	SUBCASE("Instances with added children are not pooled") {
+		Node2D *added = memnew(Node2D);
+		instance->add_child(added);
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+
+	SUBCASE("Instances whose groups changed are not pooled") {
+		instance->add_to_group("enemies");
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+
+	SUBCASE("Instances that left a packed group are not pooled") {
+		instance->get_node(NodePath("Child"))->remove_from_group("spawned");
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+
+	SUBCASE("Instances connected to outside nodes are not pooled") {
+		Node *listener = memnew(Node);
+		instance->connect("tree_exited", callable_mp((Object *)listener, &Object::notify_property_list_changed));
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+		memdelete(listener);
+	}
+
+	SUBCASE("Renamed instances get their name back") {
+		instance->set_name("Renamed");
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 1);
+
+		Node *reused = packed_scene->instantiate_pooled();
+		CHECK(reused == instance);
+		CHECK(reused->get_name() == "Root");
+		memdelete(reused);
+	}
+
+	SUBCASE("Releasing twice doesn't pool an instance twice") {
+		packed_scene->release_instance(instance);
+		ERR_PRINT_OFF;
+		packed_scene->release_instance(instance);
+		ERR_PRINT_ON;
+		CHECK(packed_scene->get_instance_pool_size() == 1);
+
+		Node *reused = packed_scene->instantiate_pooled();
+		CHECK(reused == instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+		memdelete(reused);
+	}
+
+	SUBCASE("Packing again clears the pool") {
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 1);
+
+		Node2D *root = memnew(Node2D);
+		root->set_name("Other");
+		CHECK(packed_scene->pack(root) == OK);
+		memdelete(root);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+
+		Node *other = packed_scene->instantiate_pooled();
+		REQUIRE(other != nullptr);
+		CHECK(other->get_name() == "Other");
+		memdelete(other);
+	}
+
+	SUBCASE("Replacing the state clears the pool") {
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 1);
+
+		packed_scene->recreate_state();
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+
+	SUBCASE("Pool size is limited") {
+		packed_scene->set_instance_pool_max_size(0);
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_instance_pool_size() == 0);
+	}
+}
+
+} // namespace TestPackedScene
+
+#endif // TEST_PACKED_SCENE_H